@@ -1,59 +1,348 @@
 %{
 
+#include "semantic_values.h"
 #include "symbol_table.h"
 #include "ast.h"
+#include "semantic_analyzer.h"
 #include "three_addr_code.h"
+#include "diagnostics.h"
+#include "alloc_tracker.h"
+#include "trace.h"
+#include "rule_profiler.h"
+#include "perf_counters.h"
+#include "tac_metrics.h"
+#include "tac_executor.h"
+#include "output_file.h"
 #include <iostream>
 #include <fstream>
 #include <string>
-
-/* Define the type for all grammar symbols */
-#define YYSTYPE symbol_info*
+#include <string_view>
+#include <cstdlib>
+#include <cstring>
+#include <climits>
+#include <new>
+#include <atomic>
+#include <thread>
+#include <sys/resource.h>
 
 extern FILE *yyin;
 int yyparse(void);
 int yylex(void);
-extern YYSTYPE yylval;
 
-symbol_table *symtbl = new symbol_table();
-ProgramNode* ast_root = new ProgramNode();
+// --rule-profile: bison sets the default location right before each rule's
+// action, with yyn holding the rule (one past its y.output number); error
+// recovery also uses it, but not on yyloc
+rule_profiler rule_profile;
+
+/* Locations span from the first to the last symbol of a rule, empty rules sit at the previous end */
+#define YYLLOC_DEFAULT(Cur, Rhs, N) \
+	do { \
+		if(rule_profile.enabled && &(Cur) == &yyloc) rule_profile.reduce(yyn - 1); \
+		if(N) { (Cur).begin = YYRHSLOC(Rhs, 1).begin; (Cur).end = YYRHSLOC(Rhs, N).end; } \
+		else { (Cur).begin = (Cur).end = YYRHSLOC(Rhs, 0).end; } \
+	} while(0)
+#define YYLOCATION_PRINT(File, Loc) fprintf(File, "%d-%d", (Loc)->begin, (Loc)->end)
 
-int lines = 1;
+// Created by main once there is something to compile, the start rule sets the root
+symbol_table *symtbl = NULL;
+ProgramNode* ast_root = NULL;
+
+int lines = 1; //line of the token being scanned, for the log
 int errors = 0;
-ofstream outlog, outerror, outcode;
+output_file outlog, outerror, outcode; //created on first write
+
+// Everything scanned so far, the log echoes each rule's source text from here
+string scanned_text;
+line_index source_lines; //newline offsets of scanned_text, built by the scanner
+extern unsigned long token_count;
+extern long scan_ns; //time spent in the scanner, counted while tracing
+
+string_view source_text(const YYLTYPE& loc)
+{
+	return string_view(scanned_text).substr(loc.begin, loc.end - loc.begin);
+}
+
+// Interned type names carried by type_specifier
+const string* type_int = intern("int");
+const string* type_float = intern("float");
+const string* type_void = intern("void");
+
+// Allocation counting for --alloc-stats, analysis threads allocate too
+atomic<unsigned long> alloc_count{0};
+
+// Every block starts with a header so --alloc-report can charge a free to the
+// component that made the allocation; 16 bytes keep the block aligned
+struct alloc_header
+{
+	size_t size;
+	uint32_t component;
+	uint32_t tracked; //allocated while the tracker was enabled
+};
+
+void* operator new(size_t size)
+{
+	alloc_count++;
+	alloc_header* header = (alloc_header*)malloc(sizeof(alloc_header) + size);
+	if(header == NULL) throw bad_alloc();
+	header->size = size;
+	header->component = alloc_tracker::current;
+	header->tracked = alloc_tracker::enabled;
+	if(header->tracked) alloc_tracker::on_alloc(header->component, size);
+	return header + 1;
+}
+
+void operator delete(void* p) noexcept
+{
+	if(p == NULL) return;
+	alloc_header* header = (alloc_header*)p - 1;
+	if(header->tracked) alloc_tracker::on_free(header->component, header->size);
+	free(header);
+}
+
+void operator delete(void* p, size_t) noexcept { operator delete(p); }
+
+// Nodes remember where their construct starts, semantic analysis reports there
+template<class Node> Node* at(const YYLTYPE& loc, Node* node)
+{
+	node->set_offset(loc.begin);
+	return node;
+}
+
+// Adds one declarator to a declaration, a brace list arrives as an ArgumentsNode
+void add_declarator(DeclNode* decl, const string* name, ExprNode* size, ASTNode* init)
+{
+	ArgumentsNode* init_list = dynamic_cast<ArgumentsNode*>(init);
+	vector<ExprNode*> init_values;
+	if(init_list)
+	{
+		init_values = init_list->get_arguments();
+		delete init_list;
+	}
+	else if(init)
+	{
+		init_values.push_back((ExprNode*)init);
+	}
+	decl->add_var(*name, size, init_values, init_list != NULL);
+}
+
+// Lazy mode: function bodies are skimmed as text while globals and signatures
+// go into the symbol table; a body is parsed and checked only when needed.
+struct lazy_body
+{
+	string name;
+	string text;
+	int line;
+	src_offset offset; //of the opening brace in scanned_text
+	FuncDeclNode* func;
+	bool parsed;
+};
+
+int lazy_mode = 0;
+int lazy_skim_body = 0; //next LCURL starts a body to skim (read by the scanner)
+int lazy_inject_start = 0; //scanner returns LAZY_START first (re-parsing a body)
+int lazy_body_line = 0;
+extern int brace_depth; //braces open at the current token (counted by the scanner)
+vector<lazy_body> lazy_bodies;
+vector<string> lazy_called; //functions called from the bodies parsed so far
+BlockNode* lazy_parsed_body = NULL;
 
-string varlist=""; //for variable declarartion list
-vector<string>paramlist; //for parameter list fot func dec and func def
-vector<string>paramname; //for func def	
-vector<string>arglist; //to store types of function argument
+void lazy_scan_begin(const string& text, src_offset at);
+void lazy_scan_end();
 
-int is_func = 0; //is compound statement in function definition
+// Push mode: input is fed to the scanner in pieces instead of pulled from yyin
+int push_mode = 0;
+int push_input(const char* data, size_t size);
+int push_input_end();
 
-string ret_type, func_name, func_ret_type;
+// Diagnostics are recorded as they are found and written out once at the end
+diagnostics diags;
+int diagnostics_json = 0;
+int abort_parse = 0; //-fmax-errors reached, the scanner reports end of input
+
+// With --jobs the parser's own diagnostics wait here while bodies are left for
+// the threads, they are merged with the bodies' in program order (and streamed
+// with --diagnostics-format=jsonl right away)
+bool defer_reports = false;
+vector<found_diagnostic> parse_diags;
+
+void report(diag_code code, src_offset at, const string* symbol = NULL, const string* symbol2 = NULL, long number = 0)
+{
+	if(abort_parse) return; //whatever follows the cutoff is a consequence of it
+	if(defer_reports)
+	{
+		parse_diags.push_back({code, at, symbol ? *symbol : "", symbol2 ? *symbol2 : "", number});
+		diags.stream({code, source_lines.line(at), source_lines.column(at), number, {symbol, symbol2}}); //as it is found
+		return;
+	}
+	if(diags.report(code, source_lines.line(at), source_lines.column(at), symbol, symbol2, number)) errors++;
+	if(diags.limit_reached()) abort_parse = 1;
+}
+
+// An output file that could not be written, it has no place in the source
+void report_output_error(const string& path, int error_number)
+{
+	if(diags.report(DIAG_OUTPUT_FAILED, 0, 0, intern(path), intern(strerror(error_number)))) errors++;
+}
+
+extern YYLTYPE yylloc;
 
 void yyerror(char *s)
 {
-	outlog<<"At line "<<lines<<" "<<s<<endl<<endl;
-	outerror<<"At line "<<lines<<" "<<s<<endl<<endl;
-	errors++;
-	
-	varlist = "";
-	paramlist.clear();
-	paramname.clear();
-	arglist.clear();
-	is_func = 0;
-	ret_type = "";
-	func_name = "";
-	func_ret_type = "";
+	report(DIAG_SYNTAX_ERROR, yylloc.begin, intern(s)); //at the lookahead token
+}
+
+// --trace: a function definition is a span from its header to its closing brace
+long func_parse_begin = 0, func_scan_begin = 0;
+unsigned long func_tokens_begin = 0;
+
+void trace_function_parse(const string& name)
+{
+	if(!tracer::enabled) return;
+	tracer::complete("parse " + name, "parse", func_parse_begin, tracer::now(),
+		"\"tokens\": " + to_string(token_count - func_tokens_begin) + ", \"scan_us\": " + to_string((scan_ns - func_scan_begin) / 1000));
+}
+
+// Semantic analysis runs on each unit as soon as it is parsed. With --jobs=N
+// units are only declared during the parse and the function bodies are
+// checked on N threads afterwards.
+int analysis_jobs = 1;
+const int MAX_ANALYSIS_JOBS = 256;
+int unit_count = 0;
+int scope_count = 0; //scope IDs handed out, in source order so --jobs numbers them the same
+
+// A body left for the analysis threads, with the parse log written before it
+struct pending_body
+{
+	semantic_analyzer* analyzer;
+	FuncDeclNode* func;
+	string log_before;
+	vector<found_diagnostic> diags_before;
+};
+vector<pending_body> pending_bodies;
+
+// With --jobs the parse log waits here, so each body's scope log can be put
+// back where the single-threaded analysis writes it
+ostringstream parse_log;
+streambuf* log_file = NULL;
+
+// First of the scope IDs for checking func's body
+int reserve_scopes(FuncDeclNode* func)
+{
+	int first = scope_count + 1;
+	scope_count += semantic_analyzer::scopes_opened(func);
+	return first;
+}
+
+// Diagnostics and scope dumps of one analyzer, in program order
+void merge_reports(const vector<found_diagnostic>& found)
+{
+	for(auto& d : found)
+	{
+		report(d.code, d.offset, d.symbol.empty() ? NULL : intern(d.symbol), d.symbol2.empty() ? NULL : intern(d.symbol2), d.number);
+	}
+}
+
+void merge_analysis(semantic_analyzer* analyzer)
+{
+	diags.enter_function();
+	merge_reports(analyzer->found);
+	outlog<<analyzer->log.str();
+}
+
+void analyze_unit(ASTNode* unit)
+{
+	if(unit == NULL) return;
+	alloc_scope scope(ALLOC_SEMANTIC);
+	FuncDeclNode* func = dynamic_cast<FuncDeclNode*>(unit);
+	trace_span span("semantic", "analyze ", func ? func->get_name() : "globals");
+
+	semantic_analyzer* analyzer = new semantic_analyzer(symtbl->get_curr_scope(), ++unit_count, reserve_scopes(func));
+	analyzer->declare_unit(unit);
+
+	if(analysis_jobs > 1)
+	{
+		pending_bodies.push_back({analyzer, func, parse_log.str(), move(parse_diags)});
+		parse_log.str("");
+		parse_diags.clear();
+		return;
+	}
+
+	if(func) analyzer->check_function(func);
+	merge_analysis(analyzer);
+	delete analyzer;
+}
+
+// Checks the bodies left by the parse. Every unit is declared by now, the
+// threads only read the global scope and each analyzer opens its own scopes.
+void analyze_pending_bodies()
+{
+	atomic<size_t> next{0};
+	vector<thread> workers;
+	for(int i = 0; i < analysis_jobs; i++)
+	{
+		workers.emplace_back([&next, i]() {
+			alloc_scope scope(ALLOC_SEMANTIC);
+			tracer::name_thread("analysis worker " + to_string(i + 1));
+			for(size_t k; (k = next++) < pending_bodies.size(); )
+			{
+				FuncDeclNode* func = pending_bodies[k].func;
+				if(func == NULL) continue;
+				trace_span span("semantic", "analyze ", func->get_name());
+				pending_bodies[k].analyzer->check_function(func);
+			}
+		});
+	}
+	for(auto& worker : workers) worker.join();
+
+	alloc_scope scope(ALLOC_SEMANTIC);
+	trace_span span("semantic", "merge analysis");
+	outlog.rdbuf(log_file);
+	defer_reports = false;
+	for(auto& pending : pending_bodies)
+	{
+		outlog<<pending.log_before;
+		merge_reports(pending.diags_before);
+		merge_analysis(pending.analyzer);
+		delete pending.analyzer;
+	}
+	outlog<<parse_log.str();
+	merge_reports(parse_diags);
+	parse_log.str("");
+	parse_diags.clear();
+	pending_bodies.clear();
 }
 
 %}
 
+%locations
+%define api.push-pull both
+
+/* Values carried by grammar symbols, no symbol owns heap memory of its own */
+%union {
+	const string* name; // identifiers, operators, literals and type names: interned spelling
+	ExprNode* expr;     // expressions, typed later by semantic analysis
+	ASTNode* node;      // units, statements, declarations and lists
+	int64_t int_value;  // integer literals, converted by the scanner
+	double float_value; // float literals
+}
+
 /* Declare tokens */
-%token IF ELSE FOR WHILE DO BREAK INT CHAR FLOAT DOUBLE VOID RETURN SWITCH CASE DEFAULT CONTINUE PRINTLN ADDOP MULOP INCOP DECOP RELOP ASSIGNOP LOGICOP NOT LPAREN RPAREN LCURL RCURL LTHIRD RTHIRD COMMA SEMICOLON CONST_INT CONST_FLOAT ID
+%token IF ELSE FOR WHILE DO BREAK INT CHAR FLOAT DOUBLE VOID RETURN SWITCH CASE DEFAULT CONTINUE PRINTLN INCOP DECOP ASSIGNOP NOT LPAREN RPAREN LCURL RCURL LTHIRD RTHIRD COMMA SEMICOLON COLON LAZY_BODY LAZY_START
+%token <name> ADDOP MULOP RELOP LOGICOP ID
+%token <int_value> CONST_INT
+%token <float_value> CONST_FLOAT
+
+%type <name> type_specifier id_name
+%type <expr> variable expression logic_expression array_size
+%type <node> program unit func_definition compound_statement var_declaration statements statement expression_statement case_list case_label initializer initializer_list argument_list arguments parameter_list declaration_list
 
 %nonassoc LOWER_THAN_ELSE
 %nonassoc ELSE
+%nonassoc LOGICOP
+%nonassoc RELOP
+%left ADDOP
+%left MULOP
+%right NOT UNARY
 
 %%
 
@@ -61,350 +350,217 @@ start : program
 	{
 		outlog<<"At line no: "<<lines<<" start : program "<<endl<<endl;
 		outlog<<"Symbol Table"<<endl<<endl;
-		
+
 		symtbl->Print_all_scope(outlog);
-		
-		$$ = $1;
+
 		// Root of AST is the program node
-		ast_root = (ProgramNode*)$1->get_ast_node();
+		ast_root = (ProgramNode*)$1;
+	}
+	| LAZY_START compound_statement
+	{
+		// A skimmed function body parsed on demand
+		lazy_parsed_body = (BlockNode*)$2;
 	}
 	;
 
 program : program unit
 	{
 		outlog<<"At line no: "<<lines<<" program : program unit "<<endl<<endl;
-		outlog<<$1->getname()+"\n"+$2->getname()<<endl<<endl;
-		
-		$$ = new symbol_info($1->getname()+"\n"+$2->getname(),"program");
-		
-		// Create/update AST node for program
-		ProgramNode* prog;
-		if($1->get_ast_node()) {
-			prog = (ProgramNode*)$1->get_ast_node();
-		} else {
-			prog = new ProgramNode();
-		}
-		
+		outlog<<source_text(@$)<<endl<<endl;
+
 		// Add the unit to the program
-		if($2->get_ast_node()) {
-			prog->add_unit($2->get_ast_node());
+		ProgramNode* prog = (ProgramNode*)$1;
+		if($2) {
+			prog->add_unit($2);
 		}
-		
-		$$->set_ast_node(prog);
+		$$ = prog;
 	}
 	| unit
 	{
 		outlog<<"At line no: "<<lines<<" program : unit "<<endl<<endl;
-		outlog<<$1->getname()<<endl<<endl;
-		
-		$$ = new symbol_info($1->getname(),"program");
-		
+		outlog<<source_text(@$)<<endl<<endl;
+
 		// Create AST node for program with a single unit
 		ProgramNode* prog = new ProgramNode();
-		if($1->get_ast_node()) {
-			prog->add_unit($1->get_ast_node());
+		if($1) {
+			prog->add_unit($1);
 		}
-		$$->set_ast_node(prog);
+		$$ = prog;
 	}
 	;
 
 unit : var_declaration
 	 {
 		outlog<<"At line no: "<<lines<<" unit : var_declaration "<<endl<<endl;
-		outlog<<$1->getname()<<endl<<endl;
-		
-		$$ = new symbol_info($1->getname(),"unit");
-		$$->set_ast_node($1->get_ast_node());
+		outlog<<source_text(@$)<<endl<<endl;
+
+		// Globals are static data, their initializers must be constant
+		((DeclNode*)$1)->set_global(true);
+		$$ = $1;
+		analyze_unit($$);
 	 }
      | func_definition
      {
 		outlog<<"At line no: "<<lines<<" unit : func_definition "<<endl<<endl;
-		outlog<<$1->getname()<<endl<<endl;
-		
-		$$ = new symbol_info($1->getname(),"unit");
-		$$->set_ast_node($1->get_ast_node());
+		outlog<<source_text(@$)<<endl<<endl;
+
+		$$ = $1;
+		analyze_unit($$);
 	 }
 	 | error
 	 {
-	 	$$ = new symbol_info("","unit");
+	 	$$ = NULL;
 	 }
      ;
 
 func_definition : type_specifier id_name LPAREN parameter_list RPAREN enter_func compound_statement
-		{	
+		{
 			outlog<<"At line no: "<<lines<<" func_definition : type_specifier ID LPAREN parameter_list RPAREN compound_statement "<<endl<<endl;
-			outlog<<$1->getname()<<" "<<$2->getname()<<"("+$4->getname()+")\n"<<$7->getname()<<endl<<endl;
-			
-			$$ = new symbol_info($1->getname()+" "+$2->getname()+"("+$4->getname()+")\n"+$7->getname(),"func_def");	
-			
+			outlog<<source_text(@$)<<endl<<endl;
+
 			// Create AST node for function definition
-			FuncDeclNode* func = new FuncDeclNode($1->getname(), $2->getname());
-			
+			FuncDeclNode* func = at(@$, new FuncDeclNode(*$1, *$2));
+
 			// Add parameters
-			for(int i = 0; i < paramlist.size(); i++) {
-				if(paramname[i] != "_null_") {
-					func->add_param(paramlist[i], paramname[i]);
-				}
+			ParameterListNode* params = (ParameterListNode*)$4;
+			for(auto& param : params->get_params()) {
+				func->add_param(param.first, param.second);
 			}
-			
+			delete params;
+
 			// Set body
-			if($7->get_ast_node()) {
-				func->set_body((BlockNode*)$7->get_ast_node());
+			if($7) {
+				func->set_body((BlockNode*)$7);
 			}
-			
-			$$->set_ast_node(func);
-			
-			if(symtbl->getID()!=1)
-			{
-				symtbl->Remove_from_table($2->getname());
-			}
-			
-			paramlist.clear();
-			paramname.clear();	
+
+			$$ = func;
+			trace_function_parse(*$2);
 		}
 		| type_specifier id_name LPAREN RPAREN enter_func compound_statement
 		{
-			
+
 			outlog<<"At line no: "<<lines<<" func_definition : type_specifier ID LPAREN RPAREN compound_statement "<<endl<<endl;
-			outlog<<$1->getname()<<" "<<$2->getname()<<"()\n"<<$6->getname()<<endl<<endl;
-			
-			$$ = new symbol_info($1->getname()+" "+$2->getname()+"()\n"+$6->getname(),"func_def");	
-			
+			outlog<<source_text(@$)<<endl<<endl;
+
 			// Create AST node for function definition
-			FuncDeclNode* func = new FuncDeclNode($1->getname(), $2->getname());
-			
+			FuncDeclNode* func = at(@$, new FuncDeclNode(*$1, *$2));
+
 			// Set body
-			if($6->get_ast_node()) {
-				func->set_body((BlockNode*)$6->get_ast_node());
+			if($6) {
+				func->set_body((BlockNode*)$6);
 			}
-			
-			$$->set_ast_node(func);
-			
-			if(symtbl->getID()!=1)
-			{
-				symtbl->Remove_from_table($2->getname());
+
+			$$ = func;
+			trace_function_parse(*$2);
+		}
+		| type_specifier id_name LPAREN parameter_list RPAREN enter_func LAZY_BODY
+		{
+			outlog<<"At line no: "<<lines<<" func_definition : type_specifier ID LPAREN parameter_list RPAREN LAZY_BODY "<<endl<<endl;
+
+			FuncDeclNode* func = at(@$, new FuncDeclNode(*$1, *$2));
+			ParameterListNode* params = (ParameterListNode*)$4;
+			for(auto& param : params->get_params()) {
+				func->add_param(param.first, param.second);
 			}
-			
-			paramlist.clear();
-			paramname.clear();	
+			delete params;
+			$$ = func;
+
+			lazy_bodies.push_back({*$2, string(source_text(@7)), lazy_body_line, @7.begin, func, false});
+			trace_function_parse(*$2);
+		}
+		| type_specifier id_name LPAREN RPAREN enter_func LAZY_BODY
+		{
+			outlog<<"At line no: "<<lines<<" func_definition : type_specifier ID LPAREN RPAREN LAZY_BODY "<<endl<<endl;
+
+			FuncDeclNode* func = at(@$, new FuncDeclNode(*$1, *$2));
+			$$ = func;
+
+			lazy_bodies.push_back({*$2, string(source_text(@6)), lazy_body_line, @6.begin, func, false});
+			trace_function_parse(*$2);
 		}
  		;
 
 enter_func : {
-				//if(symtbl->getID()!="1") goto end2; //not in global scope , doesnt work because if not inserted lots of errors come in compound statement
-				
-				is_func=1;//compound statement is coming in function definition. enter parameter variables.
-				
-				if(paramlist.size()!=0) //check parameters
+				if(tracer::enabled)
 				{
-					for(int i = 0; i < paramlist.size();i++)
-					{
-						if(paramname[i]=="_null_")
-						{
-							outerror<<"At line no: "<<lines<<" Parameter "<<i+1<<"'s name not given in function definition of "<<func_name<<endl<<endl;
-							outlog<<"At line no: "<<lines<<" Parameter "<<i+1<<"'s name not given in function definition of "<<func_name<<endl<<endl;
-							errors++;
-						}
-					}
+					func_parse_begin = tracer::now();
+					func_scan_begin = scan_ns;
+					func_tokens_begin = token_count;
 				}
-				
-				//check if function already present and do error checking
-				if(symtbl->Insert_in_table(func_name,"ID"))
-				{
-					(symtbl->Lookup_in_table(func_name))->setvartype(func_ret_type);
-					(symtbl->Lookup_in_table(func_name))->setidtype("func_def");
-					(symtbl->Lookup_in_table(func_name))->setparamlist(paramlist);//initialize parameters
-					(symtbl->Lookup_in_table(func_name))->setparamname(paramname);
-				}
-				else
-				{
-					outerror<<"At line no: "<<lines<<" Multiple declaration of function "<<func_name<<endl<<endl;
-					outlog<<"At line no: "<<lines<<" Multiple declaration of function "<<func_name<<endl<<endl;
-					errors++;
-					// (symtbl->Lookup_in_table(func_name))->setidtype("func_def");
-				}
-					
-				if((symtbl->Lookup_in_table(func_name))->getvartype() != func_ret_type)
-				{
-					outerror<<"At line no: "<<lines<<" Return type mismatch of function "<<func_name<<endl<<endl;
-					outlog<<"At line no: "<<lines<<" Return type mismatch of function "<<func_name<<endl<<endl;
-					errors++;
-				}
-				
-				//end2:
-				//;
+
+				// The parser reduces this rule without reading ahead, so the
+				// scanner has not seen the body's LCURL yet
+				if(lazy_mode && brace_depth == 0) lazy_skim_body = 1;
             }
             ;
 
 parameter_list : parameter_list COMMA type_specifier ID
 		{
 			outlog<<"At line no: "<<lines<<" parameter_list : parameter_list COMMA type_specifier ID "<<endl<<endl;
-			outlog<<$1->getname()+","+$3->getname()+" "+$4->getname()<<endl<<endl;
-					
-			$$ = new symbol_info($1->getname()+","+$3->getname()+" "+$4->getname(),"param_list");
-			
-			if(count(paramname.begin(),paramname.end(),$4->getname()))
-			{
-				outerror<<"At line no: "<<lines<<" Multiple declaration of variable "<<$4->getname()<<" in parameter of "<<func_name<<endl<<endl;
-				outlog<<"At line no: "<<lines<<" Multiple declaration of variable "<<$4->getname()<<" in parameter of "<<func_name<<endl<<endl;
-				errors++;
-			}
-			
-			paramlist.push_back($3->getname());
-			paramname.push_back($4->getname());
+			outlog<<source_text(@$)<<endl<<endl;
+
+			((ParameterListNode*)$1)->add_param(*$3, *$4);
+			$$ = $1;
 		}
 		| parameter_list COMMA type_specifier
 		{
 			outlog<<"At line no: "<<lines<<" parameter_list : parameter_list COMMA type_specifier "<<endl<<endl;
-			outlog<<$1->getname()+","+$3->getname()<<endl<<endl;
-			
-			$$ = new symbol_info($1->getname()+","+$3->getname(),"param_list");
-			
-			paramlist.push_back($3->getname());
-			paramname.push_back("_null_");
+			outlog<<source_text(@$)<<endl<<endl;
+
+			((ParameterListNode*)$1)->add_param(*$3, "_null_");
+			$$ = $1;
 		}
  		| type_specifier ID
  		{
 			outlog<<"At line no: "<<lines<<" parameter_list : type_specifier ID "<<endl<<endl;
-			outlog<<$1->getname()<<" "<<$2->getname()<<endl<<endl;
-			
-			$$ = new symbol_info($1->getname()+" "+$2->getname(),"param_list");
-			
-			paramlist.push_back($1->getname());
-			paramname.push_back($2->getname());
+			outlog<<source_text(@$)<<endl<<endl;
+
+			ParameterListNode* params = new ParameterListNode();
+			params->add_param(*$1, *$2);
+			$$ = params;
 		}
 		| type_specifier
 		{
 			outlog<<"At line no: "<<lines<<" parameter_list : type_specifier "<<endl<<endl;
-			outlog<<$1->getname()<<endl<<endl;
-			
-			$$ = new symbol_info($1->getname(),"param_list");
-			
-			paramlist.push_back($1->getname());
-			paramname.push_back("_null_");
+			outlog<<source_text(@$)<<endl<<endl;
+
+			ParameterListNode* params = new ParameterListNode();
+			params->add_param(*$1, "_null_");
+			$$ = params;
 		}
  		;
 
-compound_statement : LCURL enter_scope_variables statements RCURL
-			{ 
+compound_statement : LCURL statements RCURL
+			{
  		    	outlog<<"At line no: "<<lines<<" compound_statement : LCURL statements RCURL "<<endl<<endl;
-				outlog<<"{\n"+$3->getname()+"\n}"<<endl<<endl;
-				
-				$$ = new symbol_info("{\n"+$3->getname()+"\n}","comp_stmnt");
-				
+				outlog<<source_text(@$)<<endl<<endl;
+
 				// Set AST node for compound statement
-				$$->set_ast_node($3->get_ast_node());
-				
-				symtbl->Print_all_scope(outlog);
-			    symtbl->exit_scope(outlog);
+				BlockNode* block = (BlockNode*)$2;
+				block->set_scope();
+				$$ = block;
  		    }
- 		    | LCURL enter_scope_variables RCURL
- 		    { 
+ 		    | LCURL RCURL
+ 		    {
  		    	outlog<<"At line no: "<<lines<<" compound_statement : LCURL RCURL "<<endl<<endl;
-				outlog<<"{\n}"<<endl<<endl;
-				
-				$$ = new symbol_info("{\n}","comp_stmnt");
-				
+				outlog<<source_text(@$)<<endl<<endl;
+
 				// Create empty block node
-				BlockNode* block = new BlockNode();
-				$$->set_ast_node(block);
-				
-				symtbl->Print_all_scope(outlog);
-			    symtbl->exit_scope(outlog);
+				BlockNode* block = at(@$, new BlockNode());
+				block->set_scope();
+				$$ = block;
  		    }
  		    ;
-enter_scope_variables :
-			{
-				symtbl->enter_scope(outlog);
-				
-				if(is_func == 1)
-				{
-					if(paramname.size()!=0)
-					{
-						for(int i = 0; i < paramname.size(); i++)
-						{
-							if(paramname[i]!="_null_")
-							{
-								symtbl->Insert_in_table(paramname[i],"ID");
-								(symtbl->Lookup_in_table(paramname[i]))->setidtype("var");
-								(symtbl->Lookup_in_table(paramname[i]))->setvartype(paramlist[i]);
-							}
-							
-						}
-					}
-					is_func=0; //variable entered.if more compound statements come in func efinitions, don't enter the function variables.
-				}
-				
-			}
- 		    ;
- 		    
+
 var_declaration : type_specifier declaration_list SEMICOLON
 		 {
 			outlog<<"At line no: "<<lines<<" var_declaration : type_specifier declaration_list SEMICOLON "<<endl<<endl;
-			outlog<<$1->getname()<<" "<<varlist<<";"<<endl<<endl;
-			
-			$$ = new symbol_info($1->getname()+" "+varlist+";","var_dec");
-			
-			if($1->getname()=="void")
-			{
-				outerror<<"At line no: "<<lines<<" variable type can not be void "<<endl<<endl;
-				outlog<<"At line no: "<<lines<<" variable type can not be void "<<endl<<endl;
-				errors++;
-				$1 = new symbol_info("error","type"); //variable is declared void so pass error instead
-			}
-			
-			// Create AST node for variable declaration
-			DeclNode* declNode = new DeclNode($1->getname());
-			
-			// Parse the varlist to add variables to the declaration node
-			stringstream _varlist(varlist);
-			string varname;
-			
-			while(getline(_varlist,varname,','))
-			{
-				if(varname.find("[") == string::npos) // normal variable
-				{
-					declNode->add_var(varname, 0);
-					
-					if(symtbl->Insert_in_table(varname,"ID"))
-					{
-						(symtbl->Lookup_in_table(varname))->setvartype($1->getname());
-						(symtbl->Lookup_in_table(varname))->setidtype("var");
-					}
-					else
-					{
-						outerror<<"At line no: "<<lines<<" Multiple declaration of variable "<<varname<<endl<<endl;
-						outlog<<"At line no: "<<lines<<" Multiple declaration of variable "<<varname<<endl<<endl;
-						errors++;
-					}
-				}
-				else // array
-				{
-					stringstream _varname(varname);
-					string name, size;
-					
-					getline(_varname,name,'['); // get array name
-					getline(_varname,size,']'); // get array size
-					
-					declNode->add_var(name, stoi(size));
-					
-					if(symtbl->Insert_in_table(name,"ID"))
-					{
-						(symtbl->Lookup_in_table(name))->setvartype($1->getname());
-						(symtbl->Lookup_in_table(name))->setidtype("array");
-						(symtbl->Lookup_in_table(name))->setarraysize(stoi(size));
-					}
-					else
-					{
-						outerror<<"At line no: "<<lines<<" Multiple declaration of variable "<<name<<endl<<endl;
-						outlog<<"At line no: "<<lines<<" Multiple declaration of variable "<<name<<endl<<endl;
-						errors++;
-					}
-				}
-			}
-			
-			$$->set_ast_node(declNode);
-			varlist = "";
+			outlog<<source_text(@$)<<endl<<endl;
+
+			DeclNode* declNode = (DeclNode*)$2;
+			declNode->set_type(*$1);
+			declNode->set_offset(@$.begin);
+			$$ = declNode;
 		 }
  		 ;
 
@@ -412,956 +568,1000 @@ type_specifier : INT
 		{
 			outlog<<"At line no: "<<lines<<" type_specifier : INT "<<endl<<endl;
 			outlog<<"int"<<endl<<endl;
-			
-			$$ = new symbol_info("int","type");
-			ret_type = "int";
+
+			$$ = type_int;
 	    }
  		| FLOAT
  		{
 			outlog<<"At line no: "<<lines<<" type_specifier : FLOAT "<<endl<<endl;
 			outlog<<"float"<<endl<<endl;
-			
-			$$ = new symbol_info("float","type");
-			ret_type = "float";
+
+			$$ = type_float;
 	    }
  		| VOID
  		{
 			outlog<<"At line no: "<<lines<<" type_specifier : VOID "<<endl<<endl;
 			outlog<<"void"<<endl<<endl;
-			
-			$$ = new symbol_info("void","type");
-			ret_type = "void";
+
+			$$ = type_void;
 	    }
  		;
 
-declaration_list : declaration_list COMMA id_name
+declaration_list : declaration_list COMMA id_name initializer
 		  {
- 		  	string name = $3->getname();
- 		  	outlog<<"At line no: "<<lines<<" declaration_list : declaration_list COMMA ID "<<endl<<endl;
- 		  	
- 		  	varlist=varlist+","+name;
- 		  	
-			outlog<<varlist<<endl<<endl;
-			
+ 		  	outlog<<"At line no: "<<lines<<" declaration_list : declaration_list COMMA ID initializer "<<endl<<endl;
+
+ 		  	add_declarator((DeclNode*)$1, $3, NULL, $4);
+ 		  	$$ = $1;
+
+			outlog<<source_text(@$)<<endl<<endl;
+
  		  }
- 		  | declaration_list COMMA id_name LTHIRD CONST_INT RTHIRD //array after some declaration
+ 		  | declaration_list COMMA id_name array_size initializer //array after some declaration
  		  {
- 		  	string name = $3->getname();
- 		  	string size = $5->getname();
- 		  	outlog<<"At line no: "<<lines<<" declaration_list : declaration_list COMMA ID LTHIRD CONST_INT RTHIRD "<<endl<<endl;
- 		  	
- 		  	varlist=varlist+","+name+"["+size+"]";
- 		  	
-			outlog<<varlist<<endl<<endl;
-			
+ 		  	outlog<<"At line no: "<<lines<<" declaration_list : declaration_list COMMA ID array_size initializer "<<endl<<endl;
+
+ 		  	add_declarator((DeclNode*)$1, $3, $4, $5);
+ 		  	$$ = $1;
+
+			outlog<<source_text(@$)<<endl<<endl;
+
  		  }
- 		  |id_name
+ 		  |id_name initializer
  		  {
- 		  	string name = $1->getname();
- 		  	outlog<<"At line no: "<<lines<<" declaration_list : ID "<<endl<<endl;
-			outlog<<name<<endl<<endl;
-			
-			varlist+=name;
+ 		  	outlog<<"At line no: "<<lines<<" declaration_list : ID initializer "<<endl<<endl;
+			outlog<<source_text(@$)<<endl<<endl;
+
+			// The type is filled in by var_declaration
+			DeclNode* declNode = new DeclNode("");
+			add_declarator(declNode, $1, NULL, $2);
+			$$ = declNode;
  		  }
- 		  | id_name LTHIRD CONST_INT RTHIRD //array
+ 		  | id_name array_size initializer //array
  		  {
- 		  	string name = $1->getname();
- 		  	string size = $3->getname();
- 		  	outlog<<"At line no: "<<lines<<" declaration_list : ID LTHIRD CONST_INT RTHIRD "<<endl<<endl;
-			outlog<<name+"["+size+"]"<<endl<<endl;
-			
-			varlist=varlist+name+"["+size+"]";
+ 		  	outlog<<"At line no: "<<lines<<" declaration_list : ID array_size initializer "<<endl<<endl;
+			outlog<<source_text(@$)<<endl<<endl;
+
+			DeclNode* declNode = new DeclNode("");
+			add_declarator(declNode, $1, $2, $3);
+			$$ = declNode;
  		  }
  		  ;
+
+array_size : LTHIRD logic_expression RTHIRD
+		   {
+			outlog<<"At line no: "<<lines<<" array_size : LTHIRD logic_expression RTHIRD "<<endl<<endl;
+			outlog<<source_text(@$)<<endl<<endl;
+
+			// Folded to a constant by semantic analysis
+			$$ = $2;
+		   }
+		   ;
+
+initializer :
+			{
+				$$ = NULL;
+			}
+			| ASSIGNOP logic_expression
+			{
+				outlog<<"At line no: "<<lines<<" initializer : ASSIGNOP logic_expression "<<endl<<endl;
+				outlog<<source_text(@$)<<endl<<endl;
+
+				$$ = $2;
+			}
+			| ASSIGNOP LCURL initializer_list RCURL
+			{
+				outlog<<"At line no: "<<lines<<" initializer : ASSIGNOP LCURL initializer_list RCURL "<<endl<<endl;
+				outlog<<source_text(@$)<<endl<<endl;
+
+				$$ = $3;
+			}
+			;
+
+initializer_list : initializer_list COMMA logic_expression
+				 {
+					outlog<<"At line no: "<<lines<<" initializer_list : initializer_list COMMA logic_expression "<<endl<<endl;
+					outlog<<source_text(@$)<<endl<<endl;
+
+					ArgumentsNode* values = (ArgumentsNode*)$1;
+					values->add_argument($3);
+					$$ = values;
+				 }
+				 | logic_expression
+				 {
+					outlog<<"At line no: "<<lines<<" initializer_list : logic_expression "<<endl<<endl;
+					outlog<<source_text(@$)<<endl<<endl;
+
+					ArgumentsNode* values = new ArgumentsNode();
+					values->add_argument($1);
+					$$ = values;
+				 }
+				 ;
+
 id_name : ID
 		  {
-		   	$$ = new symbol_info($1->getname(),"ID");
-		   	func_name = $1->getname();
-		   	func_ret_type = ret_type;
+		   	$$ = $1;
 		  }
  		  ;
 
 statements : statement
 	   {
 	    	outlog<<"At line no: "<<lines<<" statements : statement "<<endl<<endl;
-			outlog<<$1->getname()<<endl<<endl;
-			
-			$$ = new symbol_info($1->getname(),"stmnts");
-			
+			outlog<<source_text(@$)<<endl<<endl;
+
 			// Create block for statements
-			BlockNode* block = new BlockNode();
-			if($1->get_ast_node()) {
-				block->add_statement((StmtNode*)$1->get_ast_node());
+			BlockNode* block = at(@$, new BlockNode());
+			if($1) {
+				block->add_statement((StmtNode*)$1);
 			}
-			$$->set_ast_node(block);
+			$$ = block;
 	   }
 	   | statements statement
 	   {
 	    	outlog<<"At line no: "<<lines<<" statements : statements statement "<<endl<<endl;
-			outlog<<$1->getname()<<"\n"<<$2->getname()<<endl<<endl;
-			
-			$$ = new symbol_info($1->getname()+"\n"+$2->getname(),"stmnts");
-			
+			outlog<<source_text(@$)<<endl<<endl;
+
 			// Update block with new statement
-			BlockNode* block = (BlockNode*)$1->get_ast_node();
-			if($2->get_ast_node()) {
-				block->add_statement((StmtNode*)$2->get_ast_node());
+			BlockNode* block = (BlockNode*)$1;
+			if($2) {
+				block->add_statement((StmtNode*)$2);
 			}
-			$$->set_ast_node(block);
+			$$ = block;
 	   }
 	   | error
 	   {
-	  		$$ = new symbol_info("","stmnts");
-			BlockNode* block = new BlockNode();
-			$$->set_ast_node(block);
-	   }  
+			$$ = at(@$, new BlockNode());
+	   }
 	   | statements error
 	   {
-	   		$$ = new symbol_info($1->getname(),"stmnts");
-			$$->set_ast_node($1->get_ast_node());
+			$$ = $1;
 	   }
 	   ;
-	   
+
 statement : var_declaration
 	  {
 	    	outlog<<"At line no: "<<lines<<" statement : var_declaration "<<endl<<endl;
-			outlog<<$1->getname()<<endl<<endl;
-			
-			$$ = new symbol_info($1->getname(),"stmnt");
-			$$->set_ast_node($1->get_ast_node());
+			outlog<<source_text(@$)<<endl<<endl;
+
+			$$ = $1;
 	  }
 	  | func_definition
 	  {
-	  		outlog<<"At line no: "<<lines<<" Function definition must be in the global scope "<<endl<<endl;
-	  		outerror<<"At line no: "<<lines<<" Function definition must be in the global scope "<<endl<<endl;
-	  		errors++;
-	  		$$ = new symbol_info("","stmnt");
-	  		
+	  		report(DIAG_NESTED_FUNC_DEF, @1.begin);
+	  		delete $1;
+	  		$$ = NULL;
+
 	  }
 	  | expression_statement
 	  {
 	    	outlog<<"At line no: "<<lines<<" statement : expression_statement "<<endl<<endl;
-			outlog<<$1->getname()<<endl<<endl;
-			
-			$$ = new symbol_info($1->getname(),"stmnt");
-			$$->set_ast_node($1->get_ast_node());
+			outlog<<source_text(@$)<<endl<<endl;
+
+			$$ = $1;
 	  }
 	  | compound_statement
 	  {
 	    	outlog<<"At line no: "<<lines<<" statement : compound_statement "<<endl<<endl;
-			outlog<<$1->getname()<<endl<<endl;
-			
-			$$ = new symbol_info($1->getname(),"stmnt");
-			$$->set_ast_node($1->get_ast_node());
+			outlog<<source_text(@$)<<endl<<endl;
+
+			$$ = $1;
 	  }
 	  | FOR LPAREN expression_statement expression_statement expression RPAREN statement
 	  {
 	    	outlog<<"At line no: "<<lines<<" statement : FOR LPAREN expression_statement expression_statement expression RPAREN statement "<<endl<<endl;
-			outlog<<"for("<<$3->getname()<<$4->getname()<<$5->getname()<<")\n"<<$7->getname()<<endl<<endl;
-			
-			$$ = new symbol_info("for("+$3->getname()+$4->getname()+$5->getname()+")\n"+$7->getname(),"stmnt");
-			
+			outlog<<source_text(@$)<<endl<<endl;
+
 			// Create AST node for for loop
-			ForNode* forNode = new ForNode(
-				(ExprNode*)$3->get_ast_node(),
-				(ExprNode*)$4->get_ast_node(),
-				(ExprNode*)$5->get_ast_node(),
-				(StmtNode*)$7->get_ast_node()
-			);
-			$$->set_ast_node(forNode);
+			ForNode* forNode = at(@$, new ForNode(
+				$3,
+				$4,
+				$5,
+				(StmtNode*)$7
+			));
+			$$ = forNode;
 	  }
 	  | IF LPAREN expression RPAREN statement %prec LOWER_THAN_ELSE
 	  {
 	    	outlog<<"At line no: "<<lines<<" statement : IF LPAREN expression RPAREN statement "<<endl<<endl;
-			outlog<<"if("<<$3->getname()<<")\n"<<$5->getname()<<endl<<endl;
-			
-			$$ = new symbol_info("if("+$3->getname()+")\n"+$5->getname(),"stmnt");
-			
+			outlog<<source_text(@$)<<endl<<endl;
+
 			// Create AST node for if statement (without else)
-			IfNode* ifNode = new IfNode(
-				(ExprNode*)$3->get_ast_node(),
-				(StmtNode*)$5->get_ast_node()
-			);
-			$$->set_ast_node(ifNode);
+			IfNode* ifNode = at(@$, new IfNode(
+				$3,
+				(StmtNode*)$5
+			));
+			$$ = ifNode;
 	  }
 	  | IF LPAREN expression RPAREN statement ELSE statement
 	  {
 	    	outlog<<"At line no: "<<lines<<" statement : IF LPAREN expression RPAREN statement ELSE statement "<<endl<<endl;
-			outlog<<"if("<<$3->getname()<<")\n"<<$5->getname()<<"\nelse\n"<<$7->getname()<<endl<<endl;
-			
-			$$ = new symbol_info("if("+$3->getname()+")\n"+$5->getname()+"\nelse\n"+$7->getname(),"stmnt");
-			
+			outlog<<source_text(@$)<<endl<<endl;
+
 			// Create AST node for if-else statement
-			IfNode* ifNode = new IfNode(
-				(ExprNode*)$3->get_ast_node(),
-				(StmtNode*)$5->get_ast_node(),
-				(StmtNode*)$7->get_ast_node()
-			);
-			$$->set_ast_node(ifNode);
+			IfNode* ifNode = at(@$, new IfNode(
+				$3,
+				(StmtNode*)$5,
+				(StmtNode*)$7
+			));
+			$$ = ifNode;
 	  }
 	  | WHILE LPAREN expression RPAREN statement
 	  {
 	    	outlog<<"At line no: "<<lines<<" statement : WHILE LPAREN expression RPAREN statement "<<endl<<endl;
-			outlog<<"while("<<$3->getname()<<")\n"<<$5->getname()<<endl<<endl;
-			
-			$$ = new symbol_info("while("+$3->getname()+")\n"+$5->getname(),"stmnt");
-			
+			outlog<<source_text(@$)<<endl<<endl;
+
 			// Create AST node for while loop
-			WhileNode* whileNode = new WhileNode(
-				(ExprNode*)$3->get_ast_node(),
-				(StmtNode*)$5->get_ast_node()
-			);
-			$$->set_ast_node(whileNode);
+			WhileNode* whileNode = at(@$, new WhileNode(
+				$3,
+				(StmtNode*)$5
+			));
+			$$ = whileNode;
+	  }
+	  | DO statement WHILE LPAREN expression RPAREN SEMICOLON
+	  {
+	    	outlog<<"At line no: "<<lines<<" statement : DO statement WHILE LPAREN expression RPAREN SEMICOLON "<<endl<<endl;
+			outlog<<source_text(@$)<<endl<<endl;
+
+			// Create AST node for do-while loop
+			DoWhileNode* doWhileNode = at(@$, new DoWhileNode(
+				(StmtNode*)$2,
+				$5
+			));
+			$$ = doWhileNode;
+	  }
+	  | SWITCH LPAREN expression RPAREN LCURL case_list RCURL
+	  {
+	    	outlog<<"At line no: "<<lines<<" statement : SWITCH LPAREN expression RPAREN LCURL case_list RCURL "<<endl<<endl;
+			outlog<<source_text(@$)<<endl<<endl;
+
+			// Create AST node for switch statement
+			SwitchNode* switchNode = at(@$, (SwitchNode*)$6);
+			switchNode->set_condition($3);
+			$$ = switchNode;
+	  }
+	  | BREAK SEMICOLON
+	  {
+	    	outlog<<"At line no: "<<lines<<" statement : BREAK SEMICOLON "<<endl<<endl;
+			outlog<<source_text(@$)<<endl<<endl;
+
+			$$ = at(@$, new BreakNode());
+	  }
+	  | CONTINUE SEMICOLON
+	  {
+	    	outlog<<"At line no: "<<lines<<" statement : CONTINUE SEMICOLON "<<endl<<endl;
+			outlog<<source_text(@$)<<endl<<endl;
+
+			$$ = at(@$, new ContinueNode());
 	  }
 	  | PRINTLN LPAREN id_name RPAREN SEMICOLON
 	  {
 	    	outlog<<"At line no: "<<lines<<" statement : PRINTLN LPAREN ID RPAREN SEMICOLON "<<endl<<endl;
-			outlog<<"printf("<<$3->getname()<<");"<<endl<<endl; 
-			
-			if(symtbl->Lookup_in_table($3->getname()) == NULL)
-			{
-				outerror<<"At line no: "<<lines<<" Undeclared variable "<<$3->getname()<<endl<<endl;
-				outlog<<"At line no: "<<lines<<" Undeclared variable "<<$3->getname()<<endl<<endl;
-				errors++;
-			}
-			
-			$$ = new symbol_info("printf("+$3->getname()+");","stmnt");
-			
+			outlog<<source_text(@$)<<endl<<endl;
+
 			// Could add a PrintNode to AST if needed
 			// For now, create a basic expression statement
-			VarNode* var = new VarNode($3->getname(), 
-			                         symtbl->Lookup_in_table($3->getname()) ? 
-			                         symtbl->Lookup_in_table($3->getname())->getvartype() : "error");
-			ExprStmtNode* printNode = new ExprStmtNode(var);
-			$$->set_ast_node(printNode);
+			VarNode* var = at(@3, new VarNode(*$3));
+			ExprStmtNode* printNode = at(@$, new ExprStmtNode(var));
+			$$ = printNode;
 	  }
 	  | RETURN expression SEMICOLON
 	  {
 	    	outlog<<"At line no: "<<lines<<" statement : RETURN expression SEMICOLON "<<endl<<endl;
-			outlog<<"return "<<$2->getname()<<";"<<endl<<endl;
-			
-			$$ = new symbol_info("return "+$2->getname()+";","stmnt");
-			
+			outlog<<source_text(@$)<<endl<<endl;
+
 			// Create AST node for return statement
-			ReturnNode* returnNode = new ReturnNode((ExprNode*)$2->get_ast_node());
-			$$->set_ast_node(returnNode);
+			ReturnNode* returnNode = at(@$, new ReturnNode($2));
+			$$ = returnNode;
 	  }
 	  ;
-	  
+
+case_list : case_list case_label
+		  {
+			outlog<<"At line no: "<<lines<<" case_list : case_list case_label "<<endl<<endl;
+			outlog<<source_text(@$)<<endl<<endl;
+
+			SwitchNode* switchNode = (SwitchNode*)$1;
+			switchNode->add_case((CaseNode*)$2);
+			$$ = switchNode;
+		  }
+		  |
+		  {
+			outlog<<"At line no: "<<lines<<" case_list :  "<<endl<<endl;
+
+			$$ = new SwitchNode();
+		  }
+		  ;
+
+case_label : CASE CONST_INT COLON statements
+		   {
+			outlog<<"At line no: "<<lines<<" case_label : CASE CONST_INT COLON statements "<<endl<<endl;
+			outlog<<source_text(@$)<<endl<<endl;
+
+			$$ = at(@$, new CaseNode($2, false, (StmtNode*)$4));
+		   }
+		   | CASE CONST_INT COLON
+		   {
+			outlog<<"At line no: "<<lines<<" case_label : CASE CONST_INT COLON "<<endl<<endl;
+			outlog<<source_text(@$)<<endl<<endl;
+
+			$$ = at(@$, new CaseNode($2, false, nullptr));
+		   }
+		   | DEFAULT COLON statements
+		   {
+			outlog<<"At line no: "<<lines<<" case_label : DEFAULT COLON statements "<<endl<<endl;
+			outlog<<source_text(@$)<<endl<<endl;
+
+			$$ = at(@$, new CaseNode(0, true, (StmtNode*)$3));
+		   }
+		   | DEFAULT COLON
+		   {
+			outlog<<"At line no: "<<lines<<" case_label : DEFAULT COLON "<<endl<<endl;
+			outlog<<source_text(@$)<<endl<<endl;
+
+			$$ = at(@$, new CaseNode(0, true, nullptr));
+		   }
+		   ;
+
 expression_statement : SEMICOLON
 			{
 				outlog<<"At line no: "<<lines<<" expression_statement : SEMICOLON "<<endl<<endl;
 				outlog<<";"<<endl<<endl;
-				
-				$$ = new symbol_info(";","expr_stmt");
-				
+
 				// Create empty expression statement
-				ExprStmtNode* exprStmt = new ExprStmtNode(nullptr);
-				$$->set_ast_node(exprStmt);
-	        }			
-			| expression SEMICOLON 
+				$$ = at(@$, new ExprStmtNode(nullptr));
+	        }
+			| expression SEMICOLON
 			{
 				outlog<<"At line no: "<<lines<<" expression_statement : expression SEMICOLON "<<endl<<endl;
-				outlog<<$1->getname()<<";"<<endl<<endl;
-				
-				$$ = new symbol_info($1->getname()+";","expr_stmt");
-				
+				outlog<<source_text(@$)<<endl<<endl;
+
 				// Create expression statement from expression
-				ExprStmtNode* exprStmt = new ExprStmtNode((ExprNode*)$1->get_ast_node());
-				$$->set_ast_node(exprStmt);
+				$$ = at(@$, new ExprStmtNode($1));
 	        }
 			;
-	  
-variable : id_name 	
+
+variable : id_name
       {
 	    outlog<<"At line no: "<<lines<<" variable : ID "<<endl<<endl;
-		outlog<<$1->getname()<<endl<<endl;
-			
-		$$ = new symbol_info($1->getname(),"varbl");
-		
-		if(symtbl->Lookup_in_table($1->getname()) == NULL)
-		{
-			outerror<<"At line no: "<<lines<<" Undeclared variable "<<$1->getname()<<endl<<endl;
-			outlog<<"At line no: "<<lines<<" Undeclared variable "<<$1->getname()<<endl<<endl;
-			errors++;
-			
-			$$->setvartype("error");; //not found set error type
-		}
-		else if((symtbl->Lookup_in_table($1->getname()))->getidtype() != "var") //variable is not a normal variable
-		{
-			if((symtbl->Lookup_in_table($1->getname()))->getidtype() == "array")
-			{
-				outerror<<"At line no: "<<lines<<" variable is of array type : "<<$1->getname()<<endl<<endl;
-				outlog<<"At line no: "<<lines<<" variable is of array type : "<<$1->getname()<<endl<<endl;
-				errors++;
-			}
-			else if((symtbl->Lookup_in_table($1->getname()))->getidtype() == "func_def") 
-			{
-				outerror<<"At line no: "<<lines<<" variable is of function type : "<<$1->getname()<<endl<<endl;
-				outlog<<"At line no: "<<lines<<" variable is of function type : "<<$1->getname()<<endl<<endl;
-				errors++;
-			}
-			else if((symtbl->Lookup_in_table($1->getname()))->getidtype() == "func_dec") 
-			{
-				outerror<<"At line no: "<<lines<<" variable is of function type : "<<$1->getname()<<endl<<endl;
-				outlog<<"At line no: "<<lines<<" variable is of function type : "<<$1->getname()<<endl<<endl;
-				errors++;
-			}
-			
-			
-			$$->setvartype("error");; //doesnt match set error type
-		}
-		else $$->setvartype((symtbl->Lookup_in_table($1->getname()))->getvartype());  //set variable type as id type
-		
+		outlog<<source_text(@$)<<endl<<endl;
+
 		// Create AST node for variable
-		VarNode* varNode = new VarNode($1->getname(), $$->getvartype());
-		$$->set_ast_node(varNode);
-	 }	
-	 | id_name LTHIRD expression RTHIRD 
+		$$ = at(@$, new VarNode(*$1));
+	 }
+	 | id_name LTHIRD expression RTHIRD
 	 {
 	 	outlog<<"At line no: "<<lines<<" variable : ID LTHIRD expression RTHIRD "<<endl<<endl;
-		outlog<<$1->getname()<<"["<<$3->getname()<<"]"<<endl<<endl;
-		
-		$$ = new symbol_info($1->getname()+"["+$3->getname()+"]","varbl");
-		
-		if(symtbl->Lookup_in_table($1->getname()) == NULL)
-		{
-			outerror<<"At line no: "<<lines<<" Undeclared variable "<<$1->getname()<<endl<<endl;
-			outlog<<"At line no: "<<lines<<" Undeclared variable "<<$1->getname()<<endl<<endl;
-			errors++;
-			
-			$$->setvartype("error");; //not found set error type
-		}
-		else if((symtbl->Lookup_in_table($1->getname()))->getidtype() != "array") //variable is not an array
-		{
-			outerror<<"At line no: "<<lines<<" variable is not of array type : "<<$1->getname()<<endl<<endl;
-			outlog<<"At line no: "<<lines<<" variable is not of array type : "<<$1->getname()<<endl<<endl;
-			errors++;
-			
-			$$->setvartype("error");; //doesnt match set error type
-		}
-		else if($3->getvartype()!="int") // get type of expression of array index
-		{
-			outerror<<"At line no: "<<lines<<" array index is not of integer type : "<<$1->getname()<<endl<<endl;
-			outlog<<"At line no: "<<lines<<" array index is not of integer type : "<<$1->getname()<<endl<<endl;
-			errors++;
-			
-			$$->setvartype("error");
-		}
-		else
-		{
-			$$->setvartype((symtbl->Lookup_in_table($1->getname()))->getvartype());
-		}
-		
+		outlog<<source_text(@$)<<endl<<endl;
+
 		// Create AST node for array access
-		VarNode* varNode = new VarNode($1->getname(), $$->getvartype(), (ExprNode*)$3->get_ast_node());
-		$$->set_ast_node(varNode);
+		$$ = at(@$, new VarNode(*$1, $3));
 	 }
 	 ;
-	 
+
 expression : logic_expression //expr can be void
 	   {
 	    	outlog<<"At line no: "<<lines<<" expression : logic_expression "<<endl<<endl;
-			outlog<<$1->getname()<<endl<<endl;
-			
-			$$ = new symbol_info($1->getname(),"expr");
-			$$->setvartype($1->getvartype());
-			$$->set_ast_node($1->get_ast_node());
+			outlog<<source_text(@$)<<endl<<endl;
+
+			$$ = $1;
 	   }
-	   | variable ASSIGNOP logic_expression 	
+	   | variable ASSIGNOP logic_expression
 	   {
 	    	outlog<<"At line no: "<<lines<<" expression : variable ASSIGNOP logic_expression "<<endl<<endl;
-			outlog<<$1->getname()<<"="<<$3->getname()<<endl<<endl;
+			outlog<<source_text(@$)<<endl<<endl;
 
-			$$ = new symbol_info($1->getname()+"="+$3->getname(),"expr");
-			$$->setvartype($1->getvartype());
-			
-			if($1->getvartype() == "void" || $3->getvartype() == "void") //if any of them is a void
-			{
-				outerror<<"At line no: "<<lines<<" operation on void type "<<endl<<endl;
-				outlog<<"At line no: "<<lines<<" operation on void type "<<endl<<endl;
-				errors++;
-				
-				$$->setvartype("error");
-			}
-			else if($1->getvartype() == "int" && $3->getvartype() == "float") // assignment of float into int
-			{
-				outerror<<"At line no: "<<lines<<" Warning: Assignment of float value into variable of integer type "<<endl<<endl;
-				outlog<<"At line no: "<<lines<<" Warning: Assignment of float value into variable of integer type "<<endl<<endl;
-				errors++;
-				
-				$$->setvartype("int");
-			}
-			
-			if($1->getvartype() == "error" || $3->getvartype() == "error") //if any of them is a error
-			{
-				$$->setvartype("error");
-			}
-			
 			// Create AST node for assignment
-			AssignNode* assignNode = new AssignNode(
-				(VarNode*)$1->get_ast_node(),
-				(ExprNode*)$3->get_ast_node(),
-				$$->getvartype()
-			);
-			$$->set_ast_node(assignNode);
+			$$ = at(@$, new AssignNode((VarNode*)$1, $3));
 	   }
 	   ;
-			
-logic_expression : rel_expression //lgc_expr can be void
-	     {
-	    	outlog<<"At line no: "<<lines<<" logic_expression : rel_expression "<<endl<<endl;
-			outlog<<$1->getname()<<endl<<endl;
-			
-			$$ = new symbol_info($1->getname(),"lgc_expr");
-			$$->setvartype($1->getvartype());
-			$$->set_ast_node($1->get_ast_node());
-	     }	
-		 | rel_expression LOGICOP rel_expression 
+
+/* Operator precedence replaces the old rel_expression/simple_expression/term/unary_expression/factor
+   levels, so a lone operand reaches expression without a chain of unit reductions */
+logic_expression : logic_expression LOGICOP logic_expression //lgc_expr can be void
 		 {
-	    	outlog<<"At line no: "<<lines<<" logic_expression : rel_expression LOGICOP rel_expression "<<endl<<endl;
-			outlog<<$1->getname()<<$2->getname()<<$3->getname()<<endl<<endl;
-			
-			$$ = new symbol_info($1->getname()+$2->getname()+$3->getname(),"lgc_expr");
-			$$->setvartype("int");
-			
-			//do type checking of both side of logicop
-			
-			if($1->getvartype() == "void" || $3->getvartype() == "void") //if any of them is a void
-			{
-				outerror<<"At line no: "<<lines<<" operation on void type "<<endl<<endl;
-				outlog<<"At line no: "<<lines<<" operation on void type "<<endl<<endl;
-				errors++;
-				
-				$$->setvartype("error");
-			}
-			
-			if($1->getvartype() == "error" || $3->getvartype() == "error") //if any of them is a error
-			{
-				$$->setvartype("error");
-			}
-			
+	    	outlog<<"At line no: "<<lines<<" logic_expression : logic_expression LOGICOP logic_expression "<<endl<<endl;
+			outlog<<source_text(@$)<<endl<<endl;
+
 			// Create AST node for logical operation
-			BinaryOpNode* logicNode = new BinaryOpNode(
-				$2->getname(),
-				(ExprNode*)$1->get_ast_node(),
-				(ExprNode*)$3->get_ast_node(),
-				$$->getvartype()
-			);
-			$$->set_ast_node(logicNode);
-	     }	
-		 ;
-			
-rel_expression	: simple_expression //rel_expr can be void
-		{
-	    	outlog<<"At line no: "<<lines<<" rel_expression : simple_expression "<<endl<<endl;
-			outlog<<$1->getname()<<endl<<endl;
-			
-			$$ = new symbol_info($1->getname(),"rel_expr");
-			$$->setvartype($1->getvartype());
-			$$->set_ast_node($1->get_ast_node());
-	    }
-		| simple_expression RELOP simple_expression
-		{
-	    	outlog<<"At line no: "<<lines<<" rel_expression : simple_expression RELOP simple_expression "<<endl<<endl;
-			outlog<<$1->getname()<<$2->getname()<<$3->getname()<<endl<<endl;
-			
-			$$ = new symbol_info($1->getname()+$2->getname()+$3->getname(),"rel_expr");
-			$$->setvartype("int");
-			
-			//do type checking of both side of relop
-			
-			if($1->getvartype() == "void" || $3->getvartype() == "void") //if any of them is a void
-			{
-				outerror<<"At line no: "<<lines<<" operation on void type "<<endl<<endl;
-				outlog<<"At line no: "<<lines<<" operation on void type "<<endl<<endl;
-				errors++;
-				
-				$$->setvartype("error");
-			}
-			
-			if($1->getvartype() == "error" || $3->getvartype() == "error") //if any of them is a error
-			{
-				$$->setvartype("error");
-			}
-			
+			$$ = at(@$, new BinaryOpNode(*$2, $1, $3));
+	     }
+		 | logic_expression RELOP logic_expression
+		 {
+	    	outlog<<"At line no: "<<lines<<" logic_expression : logic_expression RELOP logic_expression "<<endl<<endl;
+			outlog<<source_text(@$)<<endl<<endl;
+
 			// Create AST node for relational operation
-			BinaryOpNode* relNode = new BinaryOpNode(
-				$2->getname(),
-				(ExprNode*)$1->get_ast_node(),
-				(ExprNode*)$3->get_ast_node(),
-				$$->getvartype()
-			);
-			$$->set_ast_node(relNode);
-	    }
-		;
-				
-simple_expression : term //simp_expr can be void
-          {
-	    	outlog<<"At line no: "<<lines<<" simple_expression : term "<<endl<<endl;
-			outlog<<$1->getname()<<endl<<endl;
-			
-			$$ = new symbol_info($1->getname(),"simp_expr");
-			$$->setvartype($1->getvartype());
-			$$->set_ast_node($1->get_ast_node());
-			
-	      }
-		  | simple_expression ADDOP term 
-		  {
-	    	outlog<<"At line no: "<<lines<<" simple_expression : simple_expression ADDOP term "<<endl<<endl;
-			outlog<<$1->getname()<<$2->getname()<<$3->getname()<<endl<<endl;
-			
-			$$ = new symbol_info($1->getname()+$2->getname()+$3->getname(),"simp_expr");
-			$$->setvartype($1->getvartype());
-			
-			//do type checking of both side of addop
-			
-			if($1->getvartype() == "void" || $3->getvartype() == "void") //if any of them is a void
-			{
-				outerror<<"At line no: "<<lines<<" operation on void type "<<endl<<endl;
-				outlog<<"At line no: "<<lines<<" operation on void type "<<endl<<endl;
-				errors++;
-				
-				$$->setvartype("error");
-			}
-			else if($1->getvartype() == "float" || $3->getvartype() == "float") //if any of them is a float
-			{
-				$$->setvartype("float");
-			}
-			else $$->setvartype("int");
-			
-			if($1->getvartype() == "error" || $3->getvartype() == "error") //if any of them is a error
-			{
-				$$->setvartype("error");
-			}
-			
-			// Create AST node for addition/subtraction
-			BinaryOpNode* addopNode = new BinaryOpNode(
-				$2->getname(),
-				(ExprNode*)$1->get_ast_node(),
-				(ExprNode*)$3->get_ast_node(),
-				$$->getvartype()
-			);
-			$$->set_ast_node(addopNode);
-	      }
-		  ;
-					
-term :	unary_expression //term can be void because of un_expr->factor
-     {
-	    	outlog<<"At line no: "<<lines<<" term : unary_expression "<<endl<<endl;
-			outlog<<$1->getname()<<endl<<endl;
-			
-			$$ = new symbol_info($1->getname(),"term");
-			$$->setvartype($1->getvartype());
-			$$->set_ast_node($1->get_ast_node());
-			
-	 }
-     |  term MULOP unary_expression
-     {
-	    	outlog<<"At line no: "<<lines<<" term : term MULOP unary_expression "<<endl<<endl;
-			outlog<<$1->getname()<<$2->getname()<<$3->getname()<<endl<<endl;
-			
-			$$ = new symbol_info($1->getname()+$2->getname()+$3->getname(),"term");
-			$$->setvartype($1->getvartype());
-			
-			//do type checking of both side of mulop
-			if($1->getvartype() == "void" || $3->getvartype() == "void") //if any of them is a void
-			{
-				outerror<<"At line no: "<<lines<<" operation on void type "<<endl<<endl;
-				outlog<<"At line no: "<<lines<<" operation on void type "<<endl<<endl;
-				errors++;
-				
-				$$->setvartype("error");
-			}
-			else if($1->getvartype() == "float" || $3->getvartype() == "float") //if any of them is a float
-			{
-				$$->setvartype("float");
-			}
-			else $$->setvartype("int");
-			
-			//check if both int for modulous
-			if($2->getname() == "%")
-			{
-				if($1->getvartype() == "int" && $3->getvartype() == "int")
-				{
-					if($3->getname()=="0")
-					{
-						outerror<<"At line no: "<<lines<<" Modulus by 0 "<<endl<<endl;
-						outlog<<"At line no: "<<lines<<" Modulus by 0 "<<endl<<endl;
-						errors++;
-						
-						$$->setvartype("error");
-					}
-					else $$->setvartype("int");
-				}
-				else if($1->getvartype() == "float" || $3->getvartype() == "float")
-				{
-					outerror<<"At line no: "<<lines<<" Modulus operator on non integer type "<<endl<<endl;
-					outlog<<"At line no: "<<lines<<" Modulus operator on non integer type "<<endl<<endl;
-					errors++;
-					
-					$$->setvartype("error");
-				}
-			}
-			
-			if($2->getname() == "/") //divide by 0
-			{
-				if($3->getname()=="0")
-				{
-					outerror<<"At line no: "<<lines<<" Divide by 0 "<<endl<<endl;
-					outlog<<"At line no: "<<lines<<" Divide by 0 "<<endl<<endl;
-					errors++;
-					
-					$$->setvartype("error");
-				}
-			}
-			if($1->getvartype() == "error" || $3->getvartype() == "error") //if any of them is a error
-			{
-				$$->setvartype("error");
-			}
-			
-			// Create AST node for multiplication/division/modulus
-			BinaryOpNode* mulopNode = new BinaryOpNode(
-				$2->getname(),
-				(ExprNode*)$1->get_ast_node(),
-				(ExprNode*)$3->get_ast_node(),
-				$$->getvartype()
-			);
-			$$->set_ast_node(mulopNode);
-	 }
-     ;
+			$$ = at(@$, new BinaryOpNode(*$2, $1, $3));
+	     }
+		 | logic_expression ADDOP logic_expression
+		 {
+	    	outlog<<"At line no: "<<lines<<" logic_expression : logic_expression ADDOP logic_expression "<<endl<<endl;
+			outlog<<source_text(@$)<<endl<<endl;
 
-unary_expression : ADDOP unary_expression  // un_expr can be void because of factor
+			// Create AST node for addition/subtraction
+			$$ = at(@$, new BinaryOpNode(*$2, $1, $3));
+	     }
+		 | logic_expression MULOP logic_expression
 		 {
-	    	outlog<<"At line no: "<<lines<<" unary_expression : ADDOP unary_expression "<<endl<<endl;
-			outlog<<$1->getname()<<$2->getname()<<endl<<endl;
-			
-			$$ = new symbol_info($1->getname()+$2->getname(),"un_expr");
-			$$->setvartype($2->getvartype());
-			
-			if($2->getvartype()=="void")
-			{
-				outerror<<"At line no: "<<lines<<" operation on void type : "<<$2->getname()<<endl<<endl;
-				outlog<<"At line no: "<<lines<<" operation on void type : "<<$2->getname()<<endl<<endl;
-				errors++;
-				
-				$$->setvartype("error");
-			}
-			
-			// Create AST node for unary plus/minus
-			UnaryOpNode* unaryNode = new UnaryOpNode(
-				$1->getname(),
-				(ExprNode*)$2->get_ast_node(),
-				$$->getvartype()
-			);
-			$$->set_ast_node(unaryNode);
+	    	outlog<<"At line no: "<<lines<<" logic_expression : logic_expression MULOP logic_expression "<<endl<<endl;
+			outlog<<source_text(@$)<<endl<<endl;
+
+			// Create AST node for multiplication/division/modulus
+			$$ = at(@$, new BinaryOpNode(*$2, $1, $3));
 	     }
-		 | NOT unary_expression 
+		 | ADDOP logic_expression %prec UNARY
 		 {
-	    	outlog<<"At line no: "<<lines<<" unary_expression : NOT unary_expression "<<endl<<endl;
-			outlog<<"!"<<$2->getname()<<endl<<endl;
-			
-			$$ = new symbol_info("!"+$2->getname(),"un_expr");
-			$$->setvartype("int");
-			
-			if($2->getvartype()=="void")
-			{
-				outerror<<"At line no: "<<lines<<" operation on void type : "<<$2->getname()<<endl<<endl;
-				outlog<<"At line no: "<<lines<<" operation on void type : "<<$2->getname()<<endl<<endl;
-				errors++;
-				
-				$$->setvartype("error");
-			}
-			
-			// Create AST node for logical NOT
-			UnaryOpNode* notNode = new UnaryOpNode(
-				"!",
-				(ExprNode*)$2->get_ast_node(),
-				$$->getvartype()
-			);
-			$$->set_ast_node(notNode);
+	    	outlog<<"At line no: "<<lines<<" logic_expression : ADDOP logic_expression "<<endl<<endl;
+			outlog<<source_text(@$)<<endl<<endl;
+
+			// Create AST node for unary plus/minus, the operand text is quoted by diagnostics
+			$$ = at(@$, new UnaryOpNode(*$1, $2, string(source_text(@2))));
 	     }
-		 | factor 
+		 | NOT logic_expression
 		 {
-	    	outlog<<"At line no: "<<lines<<" unary_expression : factor "<<endl<<endl;
-			outlog<<$1->getname()<<endl<<endl;
-			
-			$$ = new symbol_info($1->getname(),"un_expr");
-			$$->setvartype($1->getvartype());
-			$$->set_ast_node($1->get_ast_node());
-			
-			//outlog<<$1->getvartype()<<endl;
+	    	outlog<<"At line no: "<<lines<<" logic_expression : NOT logic_expression "<<endl<<endl;
+			outlog<<source_text(@$)<<endl<<endl;
+
+			// Create AST node for logical NOT
+			$$ = at(@$, new UnaryOpNode("!", $2, string(source_text(@2))));
 	     }
-		 ;
-	
-factor	: variable  // factor can be void
+	 | variable
     {
-	    outlog<<"At line no: "<<lines<<" factor : variable "<<endl<<endl;
-		outlog<<$1->getname()<<endl<<endl;
-			
-		$$ = new symbol_info($1->getname(),"fctr");
-		$$->setvartype($1->getvartype());
-		$$->set_ast_node($1->get_ast_node());
+	    outlog<<"At line no: "<<lines<<" logic_expression : variable "<<endl<<endl;
+		outlog<<source_text(@$)<<endl<<endl;
+
+		$$ = $1;
 	}
-	| id_name LPAREN argument_list RPAREN
+	| id_name LPAREN argument_list RPAREN // can be void
 	{
-	    outlog<<"At line no: "<<lines<<" factor : ID LPAREN argument_list RPAREN "<<endl<<endl;
-	    outlog<<$1->getname()<<"("<<$3->getname()<<")"<<endl<<endl;
-	
-	    $$ = new symbol_info($1->getname()+"("+$3->getname()+")","fctr");
-	    $$->setvartype("error");
-	
-	    int flag = 0;
-	
-	    // Type checking (existing code)
-	    if(symtbl->Lookup_in_table($1->getname())==NULL) //undeclared function
-	    {
-	        outerror<<"At line no: "<<lines<<" Undeclared function: "<<$1->getname()<<endl<<endl;
-	        outlog<<"At line no: "<<lines<<" Undeclared function: "<<$1->getname()<<endl<<endl;
-	        errors++;
-	    }
-	    else
-	    {
-	        if((symtbl->Lookup_in_table($1->getname()))->getidtype()=="func_dec") //declared but not defined
-	        {
-	            outerror<<"At line no: "<<lines<<" Undefined function: "<<$1->getname()<<endl<<endl;
-	            outlog<<"At line no: "<<lines<<" Undefined function: "<<$1->getname()<<endl<<endl;
-	            errors++;
-	        }
-	        else if((symtbl->Lookup_in_table($1->getname()))->getidtype()=="func_def")
-	        {
-	            vector<string> templist = (symtbl->Lookup_in_table($1->getname()))->getparamlist();
-	
-	            if(arglist.size()!=templist.size()) //number of prameters don't match
-	            {
-	                outerror<<"At line no: "<<lines<<" Inconsistencies in number of arguments in function call: "<<$1->getname()<<endl<<endl;
-	                outlog<<"At line no: "<<lines<<" Inconsistencies in number of arguments in function call: "<<$1->getname()<<endl<<endl;
-	                errors++;
-	            }
-	            else if(templist.size()!=0)
-	            {
-	                for(int i = 0; i < templist.size(); i++)
-	                {
-	                    if(arglist[i]!=templist[i])
-	                    {
-	                        if(arglist[i] == "int" && templist[i] == "float") {}
-	                        else if(arglist[i]!="error")
-	                        {
-	                            flag = 1;
-	                            outerror<<"At line no: "<<lines<<" "<<"argument "<<i+1<<" type mismatch in function call: "<<$1->getname()<<endl<<endl;
-	                            outlog<<"At line no: "<<lines<<" "<<"argument "<<i+1<<" type mismatch in function call: "<<$1->getname()<<endl<<endl;
-	                            errors++;
-	                        }
-	                    }
-	                }                   
-	            }
-	            if(!flag) $$->setvartype((symtbl->Lookup_in_table($1->getname()))->getvartype());
-	        }
-	    }
-	
+	    outlog<<"At line no: "<<lines<<" logic_expression : ID LPAREN argument_list RPAREN "<<endl<<endl;
+	    outlog<<source_text(@$)<<endl<<endl;
+
 	    // Create function call node
-	    FuncCallNode* funcCall = new FuncCallNode($1->getname(), $$->getvartype());
-	
-	    // Get arguments from the ArgumentsNode if it exists
-	    if ($3->get_ast_node()) {
-	        ArgumentsNode* argsNode = dynamic_cast<ArgumentsNode*>($3->get_ast_node());
-	        if (argsNode) {
-	            // Add each argument to the function call
-	            for (auto arg : argsNode->get_arguments()) {
-	                funcCall->add_argument(arg);
-	            }
-	        }
+	    FuncCallNode* funcCall = at(@$, new FuncCallNode(*$1));
+
+	    // Get arguments from the ArgumentsNode
+	    ArgumentsNode* argsNode = (ArgumentsNode*)$3;
+	    for (auto arg : argsNode->get_arguments()) {
+	        funcCall->add_argument(arg);
 	    }
-	
-	    $$->set_ast_node(funcCall);
-	
-	    arglist.clear();
+	    delete argsNode;
+
+	    $$ = funcCall;
+
+	    if(lazy_mode) lazy_called.push_back(*$1);
 	}
 	| LPAREN expression RPAREN
 	{
-	   	outlog<<"At line no: "<<lines<<" factor : LPAREN expression RPAREN "<<endl<<endl;
-		outlog<<"("<<$2->getname()<<")"<<endl<<endl;
-		
-		$$ = new symbol_info("("+$2->getname()+")","fctr");
-		$$->setvartype($2->getvartype());
-		$$->set_ast_node($2->get_ast_node()); // Pass through the expression AST
+	   	outlog<<"At line no: "<<lines<<" logic_expression : LPAREN expression RPAREN "<<endl<<endl;
+		outlog<<source_text(@$)<<endl<<endl;
+
+		$$ = $2; // Pass through the expression AST
 	}
-	| CONST_INT 
+	| CONST_INT
 	{
-	    outlog<<"At line no: "<<lines<<" factor : CONST_INT "<<endl<<endl;
-		outlog<<$1->getname()<<endl<<endl;
-			
-		$$ = new symbol_info($1->getname(),"fctr");
-		$$->setvartype("int");
-		
+	    outlog<<"At line no: "<<lines<<" logic_expression : CONST_INT "<<endl<<endl;
+		outlog<<source_text(@$)<<endl<<endl;
+
 		// Create AST node for integer constant
-		ConstNode* intNode = new ConstNode($1->getname(), "int");
-		$$->set_ast_node(intNode);
+		$$ = at(@$, new ConstNode($1));
 	}
 	| CONST_FLOAT
 	{
-	    outlog<<"At line no: "<<lines<<" factor : CONST_FLOAT "<<endl<<endl;
-		outlog<<$1->getname()<<endl<<endl;
-			
-		$$ = new symbol_info($1->getname(),"fctr");
-		$$->setvartype("float");
-		
+	    outlog<<"At line no: "<<lines<<" logic_expression : CONST_FLOAT "<<endl<<endl;
+		outlog<<source_text(@$)<<endl<<endl;
+
 		// Create AST node for float constant
-		ConstNode* floatNode = new ConstNode($1->getname(), "float");
-		$$->set_ast_node(floatNode);
+		$$ = at(@$, new ConstNode($1));
 	}
-	| variable INCOP 
+	| variable INCOP
 	{
-	    outlog<<"At line no: "<<lines<<" factor : variable INCOP "<<endl<<endl;
-		outlog<<$1->getname()<<"++"<<endl<<endl;
-			
-		$$ = new symbol_info($1->getname()+"++","fctr");
-		$$->setvartype($1->getvartype());
-		
+	    outlog<<"At line no: "<<lines<<" logic_expression : variable INCOP "<<endl<<endl;
+		outlog<<source_text(@$)<<endl<<endl;
+
 		// Create AST nodes for increment
 		// For x++, equivalent to (x = x + 1)
-		VarNode* varNode = (VarNode*)$1->get_ast_node();
-		ConstNode* oneNode = new ConstNode("1", "int");
-		BinaryOpNode* addNode = new BinaryOpNode("+", varNode, oneNode, $1->getvartype());
-		AssignNode* assignNode = new AssignNode(varNode, addNode, $1->getvartype());
-		$$->set_ast_node(assignNode);
+		VarNode* varNode = (VarNode*)$1;
+		ConstNode* oneNode = at(@2, new ConstNode(int64_t(1)));
+		BinaryOpNode* addNode = at(@$, new BinaryOpNode("+", varNode, oneNode));
+		$$ = at(@$, new AssignNode(varNode, addNode));
 	}
 	| variable DECOP
 	{
-	    outlog<<"At line no: "<<lines<<" factor : variable DECOP "<<endl<<endl;
-		outlog<<$1->getname()<<"--"<<endl<<endl;
-			
-		$$ = new symbol_info($1->getname()+"--","fctr");
-		$$->setvartype($1->getvartype());
-		
+	    outlog<<"At line no: "<<lines<<" logic_expression : variable DECOP "<<endl<<endl;
+		outlog<<source_text(@$)<<endl<<endl;
+
 		// Create AST nodes for decrement
 		// For x--, equivalent to (x = x - 1)
-		VarNode* varNode = (VarNode*)$1->get_ast_node();
-		ConstNode* oneNode = new ConstNode("1", "int");
-		BinaryOpNode* subNode = new BinaryOpNode("-", varNode, oneNode, $1->getvartype());
-		AssignNode* assignNode = new AssignNode(varNode, subNode, $1->getvartype());
-		$$->set_ast_node(assignNode);
+		VarNode* varNode = (VarNode*)$1;
+		ConstNode* oneNode = at(@2, new ConstNode(int64_t(1)));
+		BinaryOpNode* subNode = at(@$, new BinaryOpNode("-", varNode, oneNode));
+		$$ = at(@$, new AssignNode(varNode, subNode));
 	}
 	;
-	
+
 argument_list : arguments
               {
                     outlog<<"At line no: "<<lines<<" argument_list : arguments "<<endl<<endl;
-                    outlog<<$1->getname()<<endl<<endl;
-                        
+                    outlog<<source_text(@$)<<endl<<endl;
+
                     $$ = $1; // Pass through the arguments node
               }
               |
               {
                     outlog<<"At line no: "<<lines<<" argument_list :  "<<endl<<endl;
                     outlog<<""<<endl<<endl;
-                        
-                    $$ = new symbol_info("","arg_list");
+
                     // Create empty arguments node
-                    ArgumentsNode* args = new ArgumentsNode();
-                    $$->set_ast_node(args);
+                    $$ = new ArgumentsNode();
               }
               ;
-    
+
 arguments : arguments COMMA logic_expression
           {
                 outlog<<"At line no: "<<lines<<" arguments : arguments COMMA logic_expression "<<endl<<endl;
-                outlog<<$1->getname()<<","<<$3->getname()<<endl<<endl;
-                        
-                $$ = new symbol_info($1->getname()+","+$3->getname(),"arg");
-                
-                // Get existing arguments node or create new one
-                ArgumentsNode* args;
-                if ($1->get_ast_node()) {
-                    args = dynamic_cast<ArgumentsNode*>($1->get_ast_node());
-                } else {
-                    args = new ArgumentsNode();
-                }
-                
+                outlog<<source_text(@$)<<endl<<endl;
+
                 // Add the new argument
-                if ($3->get_ast_node()) {
-                    args->add_argument(dynamic_cast<ExprNode*>($3->get_ast_node()));
-                }
-                
-                $$->set_ast_node(args);
-                arglist.push_back($3->getvartype());
+                ArgumentsNode* args = (ArgumentsNode*)$1;
+                args->add_argument($3);
+
+                $$ = args;
           }
           | logic_expression
           {
                 outlog<<"At line no: "<<lines<<" arguments : logic_expression "<<endl<<endl;
-                outlog<<$1->getname()<<endl<<endl;
-                        
-                $$ = new symbol_info($1->getname(),"arg");
-                
+                outlog<<source_text(@$)<<endl<<endl;
+
                 // Create a new arguments node with single argument
                 ArgumentsNode* args = new ArgumentsNode();
-                if ($1->get_ast_node()) {  // FIXED: Changed from $3 to $1
-                    args->add_argument(dynamic_cast<ExprNode*>($1->get_ast_node()));
-                }
-                
-                $$->set_ast_node(args);
-                arglist.push_back($1->getvartype());
+                args->add_argument($1);
+
+                $$ = args;
           }
           ;
- 
+
 
 %%
 
+// Parse and check one skimmed function body, then attach it to its FuncDeclNode
+void analyze_lazy_body(lazy_body& body)
+{
+	if(body.parsed) return;
+	body.parsed = true;
+	trace_span span("parse", "lazy body ", body.name);
+
+	outlog<<"Analyzing body of "<<body.name<<" (lazy mode)"<<endl<<endl;
+
+	int saved_lines = lines;
+	lines = body.line;
+	lazy_parsed_body = NULL;
+	diags.enter_function();
+
+	lazy_scan_begin(body.text, body.offset);
+	yyparse();
+	lazy_scan_end();
+
+	// Every global is declared by now, so all of them are visible to the body
+	if(lazy_parsed_body)
+	{
+		body.func->set_body(lazy_parsed_body);
+		alloc_scope scope(ALLOC_SEMANTIC);
+		semantic_analyzer analyzer(symtbl->get_curr_scope(), INT_MAX, reserve_scopes(body.func));
+		analyzer.check_function(body.func);
+		merge_analysis(&analyzer);
+	}
+	lines = saved_lines;
+}
+
+lazy_body* find_lazy_body(string name)
+{
+	for(auto& body : lazy_bodies)
+	{
+		if(body.name == name) return &body;
+	}
+	return NULL;
+}
+
+// Analyze the root body and every function reachable from it through calls
+void analyze_lazy_from(string root)
+{
+	vector<string> worklist = {root};
+	while(!worklist.empty())
+	{
+		string name = worklist.back();
+		worklist.pop_back();
+
+		lazy_body* body = find_lazy_body(name);
+		if(body == NULL || body->parsed || abort_parse) continue;
+
+		lazy_called.clear();
+		analyze_lazy_body(*body);
+		worklist.insert(worklist.end(), lazy_called.begin(), lazy_called.end());
+	}
+}
+
+// Names a rule for the --rule-profile report; the rule numbers match y.output
+string describe_rule(int rule)
+{
+#if YYDEBUG
+	int yyn = rule + 1;
+	return string(yytname[yyr1[yyn]]) + " (22201461.y:" + to_string(yyrline[yyn]) + ", " + to_string(yyr2[yyn]) + " symbols)";
+#else
+	return "rule " + to_string(rule);
+#endif
+}
+
+// Print what the symbol table knows about a global symbol
+void print_query(string name)
+{
+	symbol_info* sym = symtbl->Lookup_in_table(name);
+	if(sym == NULL)
+	{
+		cout<<name<<" : undeclared"<<endl;
+	}
+	else if(sym->getidtype() == "func_def")
+	{
+		cout<<name<<" : function "<<sym->getvartype()<<"(";
+		vector<string> params = sym->getparamlist();
+		for(int i = 0; i < params.size(); i++)
+		{
+			cout<<params[i];
+			if(i != params.size()-1) cout<<", ";
+		}
+		cout<<")"<<endl;
+	}
+	else if(sym->getidtype() == "array")
+	{
+		cout<<name<<" : "<<sym->getvartype()<<"["<<sym->getarraysize()<<"]"<<endl;
+	}
+	else
+	{
+		cout<<name<<" : "<<sym->getvartype()<<endl;
+	}
+}
+
+// The number after PREFIX in a NAME=N option, false unless all of it is a number in [low, high]
+bool option_number(const string& arg, size_t prefix, long low, long high, int& value)
+{
+	const char* text = arg.c_str() + prefix;
+	char* end;
+	errno = 0;
+	long parsed = strtol(text, &end, 10);
+	if(end == text || *end != '\0' || errno == ERANGE || parsed < low || parsed > high) return false;
+	value = parsed;
+	return true;
+}
+
 int main(int argc, char *argv[])
 {
-	if(argc != 2) 
+	string input_file, query, trace_file;
+	string metrics_file, metrics_baseline; //--tac-metrics
+	string code_path = "code.txt", log_path = "log.txt"; //-o, --log
+	string split_dir; //--split-output
+	int log_requested = 0;
+	int tac_metrics_on = 0;
+	int resource_usage = 0;
+	int run_code = 0;
+	int mmap_output = 0;
+	int alloc_stats = 0;
+	int diagnostics_fd = -1; //jsonl stream, stderr unless --diagnostics-fd is given
+	for(int i = 1; i < argc; i++)
+	{
+		string arg = argv[i];
+		if(arg == "--lazy") lazy_mode = 1;
+		else if(arg.rfind("--query=", 0) == 0)
+		{
+			query = arg.substr(8);
+			lazy_mode = 1;
+		}
+		else if(arg == "--alloc-stats") alloc_stats = 1;
+		else if(arg == "--alloc-report") alloc_tracker::enabled = true;
+		else if(arg.rfind("--trace=", 0) == 0) trace_file = arg.substr(8);
+		else if(arg == "--rule-profile") rule_profile.enabled = true;
+		else if(arg == "--perf-counters") perf_counters::open();
+		else if(arg == "--resource-usage") resource_usage = 1;
+		else if(arg == "--run") run_code = 1;
+		else if(arg == "--mmap-output") mmap_output = 1;
+		else if(arg == "-o" && i + 1 < argc) code_path = argv[++i];
+		else if(arg.rfind("--split-output=", 0) == 0) split_dir = arg.substr(15);
+		else if(arg.rfind("--log=", 0) == 0)
+		{
+			log_path = arg.substr(6);
+			log_requested = 1;
+		}
+		else if(arg == "--tac-metrics") tac_metrics_on = 1;
+		else if(arg.rfind("--tac-metrics=", 0) == 0)
+		{
+			metrics_file = arg.substr(14);
+			tac_metrics_on = 1;
+		}
+		else if(arg.rfind("--tac-metrics-diff=", 0) == 0)
+		{
+			metrics_baseline = arg.substr(19);
+			tac_metrics_on = 1;
+		}
+		else if(arg == "--push") push_mode = 1;
+		else if(arg.rfind("-fmax-errors=", 0) == 0)
+		{
+			int limit;
+			if(!option_number(arg, 13, 0, INT_MAX, limit))
+			{
+				cout<<"Usage: -fmax-errors=N, N a count of errors (0 for no limit), not "<<arg.substr(13)<<endl;
+				return 2;
+			}
+			diags.set_max_errors(limit);
+		}
+		else if(arg == "--diagnostics-format=json") diagnostics_json = 1;
+		else if(arg == "--diagnostics-format=text") diagnostics_json = 0;
+		else if(arg == "--diagnostics-format=jsonl") diagnostics_fd = diagnostics_fd < 0 ? 2 : diagnostics_fd;
+		else if(arg.rfind("--diagnostics-fd=", 0) == 0)
+		{
+			if(!option_number(arg, 17, 0, INT_MAX, diagnostics_fd))
+			{
+				cout<<"Usage: --diagnostics-fd=FD, FD an open file descriptor, not "<<arg.substr(17)<<endl;
+				return 2;
+			}
+		}
+		else if(arg.rfind("--jobs=", 0) == 0)
+		{
+			if(!option_number(arg, 7, 1, MAX_ANALYSIS_JOBS, analysis_jobs))
+			{
+				cout<<"Usage: --jobs=N, N from 1 to "<<MAX_ANALYSIS_JOBS<<" threads, not "<<arg.substr(7)<<endl;
+				return 2;
+			}
+		}
+		else input_file = arg;
+	}
+
+	// -o - makes the compiler a filter: code on stdout, everything else on stderr,
+	// and no log unless --log asks for one
+	int code_to_stdout = code_path == "-";
+	if(code_to_stdout)
+	{
+		ios::sync_with_stdio(false);
+		outcode.attach(cout.rdbuf());
+		outerror.attach(cerr.rdbuf());
+		cout.rdbuf(cerr.rdbuf());
+	}
+
+	if(input_file == "")
 	{
 		cout<<"Please input file name"<<endl;
 		return 0;
 	}
-	yyin = fopen(argv[1], "r");
-	outlog.open("log.txt", ios::trunc);
-	outerror.open("error.txt", ios::trunc);
-	outcode.open("code.txt", ios::trunc);
-	
+	yyin = fopen(input_file.c_str(), "r");
 	if(yyin == NULL)
 	{
 		cout<<"Couldn't open file"<<endl;
 		return 0;
 	}
-	
+
+	if(diagnostics_fd >= 0) diags.stream_to(diagnostics_fd);
+
+	// -fmax-errors stops the parse in the body that reaches the limit. Bodies left
+	// for the threads are only checked after the whole program is parsed, so
+	// with a limit they are checked as they are parsed, as with one thread
+	if(diags.get_max_errors() > 0) analysis_jobs = 1;
+
+	if(trace_file != "")
+	{
+		tracer::enabled = true;
+		tracer::name_thread("main");
+	}
+
+	if(push_mode && lazy_mode)
+	{
+		cout<<"--push can not be combined with --lazy or --query"<<endl;
+		return 2;
+	}
+
+	if(code_to_stdout && (mmap_output || tac_metrics_on || run_code))
+	{
+		cout<<"--mmap-output, --tac-metrics and --run need the code in a file, not -o -"<<endl;
+		return 2;
+	}
+
+	if(!code_to_stdout || log_requested) outlog.open(log_path);
+	if(!code_to_stdout)
+	{
+		outerror.open("error.txt");
+		outcode.open(code_path, mmap_output);
+	}
+	symtbl = new symbol_table();
+	scope_count = 1; //the global scope
+
 	// First pass: Parse the input and build AST
 	cout << "==== Pass 1: Parsing input and building AST ====" << endl;
 	outlog << "==== Pass 1: Parsing input and building AST ====" << endl;
-	
+
+	unsigned long pass1_allocs = alloc_count;
 	symtbl->enter_scope(outlog);
-	yyparse();
-	
+	alloc_scope parse_scope(ALLOC_PARSER);
+	if(analysis_jobs > 1)
+	{
+		log_file = outlog.rdbuf(parse_log.rdbuf());
+		defer_reports = true;
+	}
+	long parse_begin = tracer::now();
+	{
+		perf_phase counters("scan and parse");
+		if(push_mode)
+		{
+			// Feed the file in chunks the way a host feeding a socket or pipe would
+			char chunk[4096];
+			size_t size;
+			while((size = fread(chunk, 1, sizeof(chunk), yyin)) > 0 && push_input(chunk, size) == YYPUSH_MORE);
+			push_input_end();
+		}
+		else yyparse();
+	}
+	tracer::complete("scan and parse", "phase", parse_begin, tracer::now(),
+		"\"tokens\": " + to_string(token_count) + ", \"scan_us\": " + to_string(scan_ns / 1000));
+	if(analysis_jobs > 1)
+	{
+		trace_span span("phase", "analyze bodies");
+		perf_phase counters("analyze bodies");
+		analyze_pending_bodies();
+	}
+	pass1_allocs = alloc_count - pass1_allocs;
+
+	// Lazy mode: only the queried function, or main and what it calls, gets checked
+	if(lazy_mode)
+	{
+		perf_phase counters("lazy analysis");
+		if(query != "")
+		{
+			lazy_body* body = find_lazy_body(query);
+			if(body) analyze_lazy_body(*body);
+			print_query(query);
+		}
+		else analyze_lazy_from("main");
+	}
+
+	if(alloc_stats)
+	{
+		cout<<"Pass 1 allocations: "<<pass1_allocs<<" for "<<token_count<<" tokens ("
+			<<(token_count ? (double)pass1_allocs/token_count : 0)<<" per token)"<<endl;
+	}
+
 	outlog << endl << "Symbol Table after first pass:" << endl;
-	symtbl->Print_all_scope(outlog);
-	
+	{
+		perf_phase counters("symbol dump");
+		symtbl->Print_all_scope(outlog);
+	}
+
 	// Only proceed to second pass if no errors
-	if (errors == 0 && ast_root) {
+	int output_failed = 0; //an output file that could not be written, reported and exit status 1
+	if (query != "") {
+		outlog << endl << "Three-Address Code generation skipped for symbol query" << endl;
+	} else if (errors == 0 && ast_root) {
 		cout << "==== Pass 2: Generating Three-Address Code from AST ====" << endl;
 		outlog << endl << "==== Pass 2: Generating Three-Address Code from AST ====" << endl;
-		
+
 		// Generate three-address code (second pass)
 		outlog << "Generating Three-Address Code..." << endl;
+		alloc_scope tac_scope(ALLOC_TAC);
+		trace_span span("phase", "generate three-address code");
+		perf_phase counters("generate three-address code");
 		ThreeAddrCodeGenerator tacGen(ast_root, outcode);
+		if(split_dir != "") tacGen.split_into(split_dir);
 		tacGen.generate();
-		
+		if(tacGen.split_error())
+		{
+			report_output_error(tacGen.split_error_path(), tacGen.split_error());
+			output_failed = 1;
+		}
+
 		outlog << "Three-Address Code Generation Complete" << endl;
-		cout << "Three-Address Code Generation Complete. Output written to code.txt" << endl;
+		cout << "Three-Address Code Generation Complete. Output written to " << (code_to_stdout ? "stdout" : code_path) << endl;
 	} else {
 		cout << "Three-Address Code generation skipped due to errors" << endl;
 		outlog << endl << "Three-Address Code generation skipped due to errors" << endl;
 		outcode << "// Three-Address Code generation failed due to errors" << endl;
 	}
-	
+
+	// The code is complete, closing it before the diagnostics are written lets a failed write be one of them
+	{
+		trace_span span("phase", "flush code");
+		perf_phase counters("flush code");
+		outcode.close();
+	}
+	string code_name = code_to_stdout ? "stdout" : code_path;
+	if(outcode.mapping_error())
+	{
+		cout<<"Couldn't map "<<code_name<<" ("<<strerror(outcode.mapping_error())<<"), wrote it without --mmap-output"<<endl;
+	}
+	if(outcode.error())
+	{
+		report_output_error(code_name, outcode.error());
+		output_failed = 1;
+	}
+
+	if(abort_parse)
+	{
+		cout<<"compilation terminated due to -fmax-errors="<<diags.get_max_errors()<<endl;
+		outlog<<endl<<"compilation terminated due to -fmax-errors="<<diags.get_max_errors()<<endl;
+	}
+
+	// Diagnostics go to the log as text and to error.txt in the requested format
+	if(diags.size())
+	{
+		outlog<<endl<<"Diagnostics:"<<endl<<endl;
+		diags.render_text(outlog);
+	}
+	if(diagnostics_json) diags.render_json(outerror);
+	else diags.render_text(outerror);
+
 	outlog<<endl<<"Total lines: "<<lines<<endl;
 	outlog<<"Total errors: "<<errors<<endl;
-	outerror<<"Total errors: "<<errors<<endl;
-	
-	outlog.close();
-	outerror.close();
-	outcode.close();
-	
+	if(!diagnostics_json) outerror<<"Total errors: "<<errors<<endl;
+
+	{
+		trace_span span("phase", "flush output");
+		perf_phase counters("flush output");
+		outlog.close();
+		outerror.close();
+	}
+	if(outlog.error()) cout<<"Couldn't write "<<log_path<<": "<<strerror(outlog.error())<<endl;
+	if(outerror.error()) cout<<"Couldn't write "<<(code_to_stdout ? "stderr" : "error.txt")<<": "<<strerror(outerror.error())<<endl;
+	output_failed = output_failed || outlog.error() || outerror.error();
+
 	fclose(yyin);
-	
-	return 0;
-}
\ No newline at end of file
+
+	if(trace_file != "" && !tracer::write(trace_file))
+	{
+		cout<<"Couldn't write trace file "<<trace_file<<endl;
+	}
+
+	if(perf_counters::enabled) perf_counters::report(cout);
+
+	// Metrics are taken from code.txt as written, so they only exist when it holds code
+	if(tac_metrics_on && query == "" && errors == 0 && ast_root)
+	{
+		tac_metrics metrics;
+		ifstream code(code_path);
+		metrics.analyze(code);
+		metrics.report(cout);
+		if(metrics_file != "" && !metrics.write(metrics_file)) cout<<"Couldn't write TAC metrics file "<<metrics_file<<endl;
+		if(metrics_baseline != "") metrics.diff(metrics_baseline, cout);
+	}
+
+	if(run_code && query == "" && errors == 0 && ast_root)
+	{
+		tac_executor executor;
+		ifstream code(code_path);
+		try
+		{
+			executor.load(code);
+			executor.run(cout);
+			cout<<"Executed "<<executor.executed<<" TAC instructions"<<endl;
+		}
+		catch(const runtime_error& e)
+		{
+			cout<<"Run failed: "<<e.what()<<endl;
+		}
+	}
+
+	if(rule_profile.enabled)
+	{
+		rule_profile.pause();
+		rule_profile.report(cout, describe_rule);
+	}
+
+	if(alloc_tracker::enabled)
+	{
+		alloc_tracker::report(cout);
+		alloc_tracker::leak_report(cout);
+	}
+
+	if(resource_usage)
+	{
+		struct rusage usage;
+		getrusage(RUSAGE_SELF, &usage);
+		long cpu_us = (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000L + usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+		cout<<"Resource usage: "<<cpu_us / 1000<<" ms cpu, "<<usage.ru_maxrss<<" KB peak RSS"<<endl;
+	}
+
+	return output_failed ? 1 : 0;
+}
@@ -0,0 +1,109 @@
+#ifndef ALLOC_TRACKER_H
+#define ALLOC_TRACKER_H
+
+#include <atomic>
+#include <iostream>
+#include <iomanip>
+#include <cstddef>
+
+using namespace std;
+
+// What a heap block was allocated for. The innermost alloc_scope on the
+// allocating thread decides, anything outside one is "other".
+enum alloc_component
+{
+    ALLOC_OTHER,
+    ALLOC_LEXER,    // interned spellings, scanned text
+    ALLOC_PARSER,   // parser values and lists, node members
+    ALLOC_AST,      // the nodes themselves
+    ALLOC_SEMANTIC, // analyzer state, diagnostics
+    ALLOC_SYMBOLS,  // scopes and symbols
+    ALLOC_TAC,      // code generation temporaries and output
+    ALLOC_COMPONENTS
+};
+
+// Opt-in heap accounting (--alloc-report), fed by the global operator new and
+// delete. Blocks allocated before it is enabled are not counted at all.
+class alloc_tracker
+{
+private:
+    struct counters
+    {
+        atomic<long> calls, frees, live_bytes, peak_bytes; // static, so zero to begin with
+    };
+
+    inline static counters stats[ALLOC_COMPONENTS];
+
+public:
+    inline static bool enabled = false;
+    inline static thread_local alloc_component current = ALLOC_OTHER;
+
+    static const char* name(int component)
+    {
+        static const char* names[] = {"other", "lexer", "parser", "ast", "semantic", "symbols", "tac"};
+        return names[component];
+    }
+
+    static void on_alloc(int component, size_t size)
+    {
+        counters& c = stats[component];
+        c.calls.fetch_add(1, memory_order_relaxed);
+        long live = c.live_bytes.fetch_add(size, memory_order_relaxed) + size;
+        long peak = c.peak_bytes.load(memory_order_relaxed);
+        while (live > peak && !c.peak_bytes.compare_exchange_weak(peak, live, memory_order_relaxed));
+    }
+
+    static void on_free(int component, size_t size)
+    {
+        stats[component].frees.fetch_add(1, memory_order_relaxed);
+        stats[component].live_bytes.fetch_sub(size, memory_order_relaxed);
+    }
+
+    static void report(ostream& out)
+    {
+        out << "Allocations by component:" << endl;
+        out << left << setw(10) << "component" << right << setw(12) << "calls" << setw(12) << "frees"
+            << setw(14) << "peak bytes" << setw(14) << "live bytes" << endl;
+        for (int i = 0; i < ALLOC_COMPONENTS; i++)
+        {
+            out << left << setw(10) << name(i) << right << setw(12) << stats[i].calls << setw(12) << stats[i].frees
+                << setw(14) << stats[i].peak_bytes << setw(14) << stats[i].live_bytes << endl;
+        }
+        out << left;
+    }
+
+    // Blocks still live when the compiler exits, by the component that made them
+    static void leak_report(ostream& out)
+    {
+        out << "Still allocated at exit:" << endl;
+        bool any = false;
+        for (int i = 0; i < ALLOC_COMPONENTS; i++)
+        {
+            long blocks = stats[i].calls - stats[i].frees;
+            if (blocks == 0) continue;
+            out << "  " << name(i) << ": " << blocks << " blocks, " << stats[i].live_bytes << " bytes" << endl;
+            any = true;
+        }
+        if (!any) out << "  nothing" << endl;
+    }
+};
+
+// Charges the allocations made on this thread while it is alive to a component
+class alloc_scope
+{
+private:
+    alloc_component saved;
+
+public:
+    alloc_scope(alloc_component component) : saved(alloc_tracker::current)
+    {
+        alloc_tracker::current = component;
+    }
+
+    ~alloc_scope()
+    {
+        alloc_tracker::current = saved;
+    }
+};
+
+#endif // ALLOC_TRACKER_H
@@ -6,23 +6,65 @@
 #include <string>
 #include <fstream>
 #include <map>
+#include <algorithm>
+#include <sstream>
+#include <cstdint>
+#include <charconv>
+#include "line_index.h"
+#include "alloc_tracker.h"
+#include "trace.h"
 
 using namespace std;
 
+// Shortest text that reads back as the same double, always spelled as a float
+inline string format_float(double v) {
+    char text[32];
+    string result(text, to_chars(text, text + sizeof(text), v).ptr);
+    if (result.find_first_of(".en") == string::npos) result += ".0";
+    return result;
+}
+
+// Compile-time value of an expression. Integers fold in 64 bits and wrap like the
+// TAC executor's, only a float operand turns the result into a double.
+struct const_value {
+    bool is_float = false;
+    int64_t integer = 0;
+    double real = 0;
+
+    double as_double() const { return is_float ? real : (double)integer; }
+    int64_t as_int() const { return is_float ? (int64_t)real : integer; }
+    bool is_zero() const { return is_float ? real == 0 : integer == 0; }
+};
+
 class ASTNode {
+protected:
+    src_offset offset = 0; // Where the node starts in the source, diagnostics are reported there
+
 public:
     virtual ~ASTNode() {}
-    virtual string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp, int& temp_count, int& label_count) const = 0;
+
+    // Nodes are charged to the AST whoever creates them, their members to the caller
+    static void* operator new(size_t size) {
+        alloc_scope scope(ALLOC_AST);
+        return ::operator new(size);
+    }
+    static void operator delete(void* p) { ::operator delete(p); }
+    void set_offset(src_offset at) { offset = at; }
+    src_offset get_offset() const { return offset; }
+    virtual string generate_code(ostream& outcode, map<string, string>& symbol_to_temp, int& temp_count, int& label_count) const = 0;
 };
 
 // Expression node types
 
 class ExprNode : public ASTNode {
 protected:
-    string node_type; // Type info (int, float, void, etc.) propagated during parsing
+    string node_type; // Type info (int, float, void, error), set by semantic analysis
 public:
-    ExprNode(string type) : node_type(type) {}
+    ExprNode(string type = "") : node_type(type) {}
     virtual string get_type() const { return node_type; }
+    void set_type(string type) { node_type = type; }
+    // Compile-time value, false when the expression is not a constant
+    virtual bool evaluate_const(const_value& result) const { return false; }
 };
 
 // Variable node (for ID references)
@@ -31,27 +73,26 @@ class VarNode : public ExprNode {
 private:
     string name; 
     ExprNode* index; // Array subscript expression, nullptr when not indexing
-    inline static bool force_fresh_load = false; 
-    inline static map<string,string> last_access; 
 
 public:
-    VarNode(string name, string type, ExprNode* idx = nullptr) // Build a scalar or array reference
-        : ExprNode(type), name(name), index(idx) {}
+    VarNode(string name, ExprNode* idx = nullptr) // Build a scalar or array reference
+        : name(name), index(idx) {}
     
     ~VarNode() { if(index) delete index; } 
     
     bool has_index() const { return index != nullptr; } 
+    ExprNode* get_index() const { return index; }
     
-    string generate_index_code(ofstream& outcode, map<string, string>& symbol_to_temp,
+    string generate_index_code(ostream& outcode, map<string, string>& symbol_to_temp,
                               int& temp_count, int& label_count) const {
         if (!index) return ""; 
         return index->generate_code(outcode, symbol_to_temp, temp_count, label_count); 
     }
     
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
+    string generate_code(ostream& outcode, map<string, string>& symbol_to_temp,
                         int& temp_count, int& label_count) const override {
         string temp; 
-        if (!has_index() && !force_fresh_load && symbol_to_temp.count(name)) {
+        if (!has_index() && symbol_to_temp.count(name)) {
             temp = symbol_to_temp[name]; // Reuse cached temp for simple variable
             temp_count++; 
         } else {
@@ -64,30 +105,34 @@ public:
             }
             symbol_to_temp[name] = temp; 
         }
-        last_access[name] = temp; 
         return temp; 
     }
     
     string get_name() const { return name; } 
-    
-    static void set_force_fresh(bool v) { force_fresh_load = v; } 
-    static void clear_last_access() { last_access.clear(); } 
-    static const map<string,string>& get_last_access() { return last_access; } 
 };
 
 // Constant node
 
 class ConstNode : public ExprNode {
 private:
-    string value;
+    int64_t int_value; // literals are converted once by the scanner
+    double float_value;
 
 public:
-    ConstNode(string val, string type) : ExprNode(type), value(val) {}
+    ConstNode(int64_t value) : ExprNode("int"), int_value(value), float_value(value) {}
+    ConstNode(double value) : ExprNode("float"), int_value(value), float_value(value) {}
+    
+    bool evaluate_const(const_value& result) const override {
+        result.is_float = node_type == "float";
+        result.integer = int_value;
+        result.real = float_value;
+        return true;
+    }
     
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
+    string generate_code(ostream& outcode, map<string, string>& symbol_to_temp,
                         int& temp_count, int& label_count) const override {
         string temp = "t" + to_string(temp_count++);
-        outcode << temp << " = " << value << endl;
+        outcode << temp << " = " << (node_type == "int" ? to_string(int_value) : format_float(float_value)) << endl;
         return temp;
     }
 };
@@ -101,15 +146,63 @@ private:
     ExprNode* right; 
 
 public:
-    BinaryOpNode(string op, ExprNode* left, ExprNode* right, string result_type)
-        : ExprNode(result_type), op(op), left(left), right(right) {} // Capture operator and operands
+    BinaryOpNode(string op, ExprNode* left, ExprNode* right)
+        : op(op), left(left), right(right) {} // Capture operator and operands
     
     ~BinaryOpNode() {
         delete left; 
         delete right; 
     }
     
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
+    string get_op() const { return op; }
+    ExprNode* get_left() const { return left; }
+    ExprNode* get_right() const { return right; }
+    
+    bool evaluate_const(const_value& result) const override {
+        const_value l, r;
+        if (!left->evaluate_const(l) || !right->evaluate_const(r)) return false;
+        result = const_value();
+        if (op == "&&") result.integer = !l.is_zero() && !r.is_zero();
+        else if (op == "||") result.integer = !l.is_zero() || !r.is_zero();
+        else if (l.is_float || r.is_float) {
+            double x = l.as_double(), y = r.as_double();
+            if (op == "<") result.integer = x < y;
+            else if (op == ">") result.integer = x > y;
+            else if (op == "<=") result.integer = x <= y;
+            else if (op == ">=") result.integer = x >= y;
+            else if (op == "==") result.integer = x == y;
+            else if (op == "!=") result.integer = x != y;
+            else {
+                result.is_float = true;
+                if (op == "+") result.real = x + y;
+                else if (op == "-") result.real = x - y;
+                else if (op == "*") result.real = x * y;
+                else if (op == "/" && y != 0) result.real = x / y;
+                else return false;
+            }
+        }
+        else {
+            int64_t x = l.integer, y = r.integer;
+            if (op == "+") result.integer = (int64_t)((uint64_t)x + (uint64_t)y);
+            else if (op == "-") result.integer = (int64_t)((uint64_t)x - (uint64_t)y);
+            else if (op == "*") result.integer = (int64_t)((uint64_t)x * (uint64_t)y);
+            else if (op == "/" || op == "%") {
+                if (y == 0) return false;
+                if (x == INT64_MIN && y == -1) result.integer = op == "/" ? INT64_MIN : 0;
+                else result.integer = op == "/" ? x / y : x % y;
+            }
+            else if (op == "<") result.integer = x < y;
+            else if (op == ">") result.integer = x > y;
+            else if (op == "<=") result.integer = x <= y;
+            else if (op == ">=") result.integer = x >= y;
+            else if (op == "==") result.integer = x == y;
+            else if (op == "!=") result.integer = x != y;
+            else return false;
+        }
+        return true;
+    }
+    
+    string generate_code(ostream& outcode, map<string, string>& symbol_to_temp,
                         int& temp_count, int& label_count) const override {
         string l = left->generate_code(outcode, symbol_to_temp, temp_count, label_count); 
         string r = right->generate_code(outcode, symbol_to_temp, temp_count, label_count); 
@@ -125,14 +218,27 @@ class UnaryOpNode : public ExprNode {
 private:
     string op;
     ExprNode* expr;
+    string operand_text; // Source of the operand, quoted by diagnostics
 
 public:
-    UnaryOpNode(string op, ExprNode* expr, string result_type)
-        : ExprNode(result_type), op(op), expr(expr) {}
+    UnaryOpNode(string op, ExprNode* expr, string text = "")
+        : op(op), expr(expr), operand_text(text) {}
     
     ~UnaryOpNode() { delete expr; }
     
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
+    string get_op() const { return op; }
+    ExprNode* get_expr() const { return expr; }
+    string get_operand_text() const { return operand_text; }
+    
+    bool evaluate_const(const_value& result) const override {
+        if (!expr->evaluate_const(result)) return false;
+        if (op == "!") result = {false, result.is_zero(), 0};
+        else if (op == "-" && result.is_float) result.real = -result.real;
+        else if (op == "-") result.integer = (int64_t)(0 - (uint64_t)result.integer);
+        return true;
+    }
+    
+    string generate_code(ostream& outcode, map<string, string>& symbol_to_temp,
                         int& temp_count, int& label_count) const override {
         string val = expr->generate_code(outcode, symbol_to_temp, temp_count, label_count);
         string temp = "t" + to_string(temp_count++);
@@ -149,15 +255,18 @@ private:
     ExprNode* rhs;
 
 public:
-    AssignNode(VarNode* lhs, ExprNode* rhs, string result_type)
-        : ExprNode(result_type), lhs(lhs), rhs(rhs) {}
+    AssignNode(VarNode* lhs, ExprNode* rhs)
+        : lhs(lhs), rhs(rhs) {}
     
     ~AssignNode() {
         delete lhs;
         delete rhs;
     }
     
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
+    VarNode* get_lhs() const { return lhs; }
+    ExprNode* get_rhs() const { return rhs; }
+    
+    string generate_code(ostream& outcode, map<string, string>& symbol_to_temp,
                         int& temp_count, int& label_count) const override {
         string rval = rhs->generate_code(outcode, symbol_to_temp, temp_count, label_count);
 
@@ -176,8 +285,13 @@ public:
 // Statement node types
 
 class StmtNode : public ASTNode {
+protected:
+    // Labels of the enclosing loops and switches, innermost last: (break target, continue target).
+    // A switch has no continue target.
+    inline static vector<pair<string, string>> jump_targets;
+
 public:
-    virtual string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
+    virtual string generate_code(ostream& outcode, map<string, string>& symbol_to_temp,
                                 int& temp_count, int& label_count) const = 0;
 };
 
@@ -193,7 +307,7 @@ public:
     
     ExprNode* get_expr() const { return expr; } // Accessor for the wrapped expression
     
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
+    string generate_code(ostream& outcode, map<string, string>& symbol_to_temp,
                         int& temp_count, int& label_count) const override {
         if (expr) { 
             expr->generate_code(outcode, symbol_to_temp, temp_count, label_count); // Evaluate expression, ignore result
@@ -207,6 +321,7 @@ public:
 class BlockNode : public StmtNode {
 private:
     vector<StmtNode*> statements;
+    bool scope = false; // A compound statement opens a scope, a case body does not
 
 public:
     ~BlockNode() {
@@ -219,7 +334,11 @@ public:
         if (stmt) statements.push_back(stmt); 
     }
     
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
+    void set_scope() { scope = true; }
+    bool opens_scope() const { return scope; }
+    const vector<StmtNode*>& get_statements() const { return statements; }
+    
+    string generate_code(ostream& outcode, map<string, string>& symbol_to_temp,
                         int& temp_count, int& label_count) const override {
         for (auto stmt : statements) { // Emit code for each contained statement in order
             if (stmt) stmt->generate_code(outcode, symbol_to_temp, temp_count, label_count); 
@@ -246,7 +365,11 @@ public:
         if (else_block) delete else_block;
     }
     
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
+    ExprNode* get_condition() const { return condition; }
+    StmtNode* get_then() const { return then_block; }
+    StmtNode* get_else() const { return else_block; }
+    
+    string generate_code(ostream& outcode, map<string, string>& symbol_to_temp,
                         int& temp_count, int& label_count) const override {
         string cond_temp = condition->generate_code(outcode, symbol_to_temp, temp_count, label_count);
 
@@ -257,21 +380,27 @@ public:
         outcode << "if " << cond_temp << " goto " << true_label << endl;
         outcode << "goto " << false_label << endl;
 
+        map<string, string> before_branch = symbol_to_temp; // both branches start after the condition
+
         outcode << true_label << ":" << endl;
         if (then_block) then_block->generate_code(outcode, symbol_to_temp, temp_count, label_count);
         outcode << "goto " << end_label << endl;
 
         outcode << false_label << ":" << endl;
+        symbol_to_temp = before_branch;
         if (else_block) {
             else_block->generate_code(outcode, symbol_to_temp, temp_count, label_count);
         }
         outcode << end_label << ":" << endl;
+        symbol_to_temp.clear(); // joined from both branches
 
         return "";
     }
 };
 
 // While statement node
+// Rotated into guarded bottom-test form, so each iteration takes one branch:
+//     ifFalse cond goto end; body: ...; continue: cond; if cond goto body; end:
 
 class WhileNode : public StmtNode {
 private:
@@ -287,27 +416,79 @@ public:
         delete body;
     }
     
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
+    ExprNode* get_condition() const { return condition; }
+    StmtNode* get_body() const { return body; }
+    
+    string generate_code(ostream& outcode, map<string, string>& symbol_to_temp,
                         int& temp_count, int& label_count) const override {
-        string start_label = "L" + to_string(label_count++);
         string body_label = "L" + to_string(label_count++);
+        string cont_label = "L" + to_string(label_count++);
         string end_label = "L" + to_string(label_count++);
 
-        outcode << start_label << ":" << endl;
+        string guard_temp = condition->generate_code(outcode, symbol_to_temp, temp_count, label_count);
+        outcode << "ifFalse " << guard_temp << " goto " << end_label << endl;
+
+        outcode << body_label << ":" << endl;
+        symbol_to_temp.clear(); // loop header, also reached from the back edge
+        jump_targets.push_back(make_pair(end_label, cont_label));
+        if (body) body->generate_code(outcode, symbol_to_temp, temp_count, label_count);
+        jump_targets.pop_back();
+
+        outcode << cont_label << ":" << endl;
+        symbol_to_temp.clear(); // may be reached by a continue
         string cond_temp = condition->generate_code(outcode, symbol_to_temp, temp_count, label_count);
         outcode << "if " << cond_temp << " goto " << body_label << endl;
-        outcode << "goto " << end_label << endl;
+        outcode << end_label << ":" << endl;
+        symbol_to_temp.clear(); // may be reached by a break
+
+        return "";
+    }
+};
+
+// Do-while statement node, the body runs before the only test
+
+class DoWhileNode : public StmtNode {
+private:
+    StmtNode* body;
+    ExprNode* condition;
+
+public:
+    DoWhileNode(StmtNode* body_stmt, ExprNode* cond)
+        : body(body_stmt), condition(cond) {}
+    
+    ~DoWhileNode() {
+        delete body;
+        delete condition;
+    }
+    
+    StmtNode* get_body() const { return body; }
+    ExprNode* get_condition() const { return condition; }
+    
+    string generate_code(ostream& outcode, map<string, string>& symbol_to_temp,
+                        int& temp_count, int& label_count) const override {
+        string body_label = "L" + to_string(label_count++);
+        string cont_label = "L" + to_string(label_count++);
+        string end_label = "L" + to_string(label_count++);
 
         outcode << body_label << ":" << endl;
+        symbol_to_temp.clear(); // loop header, also reached from the back edge
+        jump_targets.push_back(make_pair(end_label, cont_label));
         if (body) body->generate_code(outcode, symbol_to_temp, temp_count, label_count);
-        outcode << "goto " << start_label << endl;
+        jump_targets.pop_back();
+
+        outcode << cont_label << ":" << endl;
+        symbol_to_temp.clear(); // may be reached by a continue
+        string cond_temp = condition->generate_code(outcode, symbol_to_temp, temp_count, label_count);
+        outcode << "if " << cond_temp << " goto " << body_label << endl;
         outcode << end_label << ":" << endl;
+        symbol_to_temp.clear(); // may be reached by a break
 
         return "";
     }
 };
 
 // For statement node
+// Rotated like WhileNode: init; ifFalse cond goto end; body: ...; update: ...; cond; if cond goto body; end:
 
 class ForNode : public StmtNode {
 private:
@@ -316,6 +497,12 @@ private:
     ExprNode* update; // Update expression run each iteration
     StmtNode* body; 
 
+    // Condition expression, nullptr when omitted (always true)
+    ExprNode* condition_expr() const {
+        if (auto es = dynamic_cast<ExprStmtNode*>(condition)) return es->get_expr();
+        return dynamic_cast<ExprNode*>(condition);
+    }
+
 public:
     ForNode(ASTNode* init_node, ASTNode* cond_node, ExprNode* update_expr, StmtNode* body_stmt)
         : init(init_node), condition(cond_node), update(update_expr), body(body_stmt) {}
@@ -327,48 +514,237 @@ public:
         delete body; 
     }
     
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
+    ASTNode* get_init() const { return init; }
+    ASTNode* get_condition() const { return condition; }
+    ExprNode* get_update() const { return update; }
+    StmtNode* get_body() const { return body; }
+    
+    string generate_code(ostream& outcode, map<string, string>& symbol_to_temp,
                         int& temp_count, int& label_count) const override {
         if (init) { 
             if (auto s = dynamic_cast<StmtNode*>(init)) s->generate_code(outcode, symbol_to_temp, temp_count, label_count); 
             else if (auto e = dynamic_cast<ExprNode*>(init)) e->generate_code(outcode, symbol_to_temp, temp_count, label_count); 
         }
 
-        string start_label = "L" + to_string(label_count++); 
         string body_label = "L" + to_string(label_count++); 
+        string update_label = "L" + to_string(label_count++); 
         string end_label = "L" + to_string(label_count++); 
-        outcode << start_label << ":" << endl; 
-        string cond_temp = "1"; // Default true if no condition
-        if (condition) { 
-            VarNode::clear_last_access(); 
-            VarNode::set_force_fresh(true); 
-            if (auto es = dynamic_cast<ExprStmtNode*>(condition)) {
-                if (es->get_expr()) cond_temp = es->get_expr()->generate_code(outcode, symbol_to_temp, temp_count, label_count); 
-                else es->generate_code(outcode, symbol_to_temp, temp_count, label_count); //cond temp=1 , es=null
-            } else if (auto e = dynamic_cast<ExprNode*>(condition)) {
-                cond_temp = e->generate_code(outcode, symbol_to_temp, temp_count, label_count); 
-            } else if (auto s = dynamic_cast<StmtNode*>(condition)) {
-                s->generate_code(outcode, symbol_to_temp, temp_count, label_count); 
-            }
-            VarNode::set_force_fresh(false); 
-            symbol_to_temp.clear();
-            for (auto& kv : VarNode::get_last_access()) {
-                symbol_to_temp[kv.first] = kv.second; // Copy last-access temps into current cache
-            }
+        ExprNode* cond = condition_expr();
+
+        if (cond) { 
+            string guard_temp = cond->generate_code(outcode, symbol_to_temp, temp_count, label_count); 
+            outcode << "ifFalse " << guard_temp << " goto " << end_label << endl; 
         }
-        outcode << "if " << cond_temp << " goto " << body_label << endl; 
-        outcode << "goto " << end_label << endl; 
 
         outcode << body_label << ":" << endl; 
+        symbol_to_temp.clear(); // loop header, also reached from the back edge
+        jump_targets.push_back(make_pair(end_label, update_label));
         if (body) body->generate_code(outcode, symbol_to_temp, temp_count, label_count);
+        jump_targets.pop_back();
+
+        outcode << update_label << ":" << endl; 
+        symbol_to_temp.clear(); // may be reached by a continue
         if (update) update->generate_code(outcode, symbol_to_temp, temp_count, label_count); // Emit update step
-        outcode << "goto " << start_label << endl; 
+        if (cond) { 
+            string cond_temp = cond->generate_code(outcode, symbol_to_temp, temp_count, label_count); 
+            outcode << "if " << cond_temp << " goto " << body_label << endl; 
+        } else {
+            outcode << "goto " << body_label << endl; // no condition, loop until break
+        }
         outcode << end_label << ":" << endl; 
+        symbol_to_temp.clear(); // may be reached by a break
 
         return "";
     }
 };
 
+// Case label of a switch statement (helper for SwitchNode)
+
+class CaseNode : public StmtNode {
+private:
+    int64_t value; // as scanned, so values past 32 bits stay distinct
+    bool is_default;
+    StmtNode* body; // nullptr for an empty case that falls through
+
+public:
+    CaseNode(int64_t val, bool def, StmtNode* body_stmt)
+        : value(val), is_default(def), body(body_stmt) {}
+    
+    ~CaseNode() { if (body) delete body; }
+    
+    int64_t get_value() const { return value; }
+    bool get_is_default() const { return is_default; }
+    StmtNode* get_body() const { return body; }
+    
+    string generate_code(ostream& outcode, map<string, string>& symbol_to_temp,
+                        int& temp_count, int& label_count) const override {
+        if (body) body->generate_code(outcode, symbol_to_temp, temp_count, label_count);
+        return "";
+    }
+};
+
+// Switch statement node
+
+class SwitchNode : public StmtNode {
+private:
+    ExprNode* condition;
+    vector<CaseNode*> cases; // In source order, bodies fall through to the next case
+
+    // Dispatch strategy thresholds
+    static const int LINEAR_MAX_CASES = 3; // up to this many values: compare one by one
+    static const int TABLE_MIN_DENSITY = 2; // jump table when range <= 2 * number of values
+
+    // Range minus one in unsigned arithmetic, which cannot overflow even for the widest range
+    static bool table_fits(const vector<pair<int64_t, string>>& targets) {
+        uint64_t span = (uint64_t)targets.back().first - (uint64_t)targets.front().first;
+        return span < (uint64_t)TABLE_MIN_DENSITY * targets.size();
+    }
+
+    void emit_linear(ostream& outcode, int& temp_count, const string& val,
+                     const vector<pair<int64_t, string>>& targets, size_t lo, size_t hi) const {
+        for (size_t i = lo; i < hi; i++) {
+            string cmp = "t" + to_string(temp_count++);
+            outcode << cmp << " = " << val << " == " << targets[i].first << endl;
+            outcode << "if " << cmp << " goto " << targets[i].second << endl;
+        }
+    }
+
+    // Balanced binary search over sorted case values, falls out to default_label
+    void emit_search(ostream& outcode, int& temp_count, int& label_count, const string& val,
+                     const vector<pair<int64_t, string>>& targets, size_t lo, size_t hi,
+                     const string& default_label) const {
+        if (hi - lo <= LINEAR_MAX_CASES) {
+            emit_linear(outcode, temp_count, val, targets, lo, hi);
+            outcode << "goto " << default_label << endl;
+            return;
+        }
+        size_t mid = lo + (hi - lo) / 2;
+        string left_label = "L" + to_string(label_count++);
+
+        string eq = "t" + to_string(temp_count++);
+        outcode << eq << " = " << val << " == " << targets[mid].first << endl;
+        outcode << "if " << eq << " goto " << targets[mid].second << endl;
+        string lt = "t" + to_string(temp_count++);
+        outcode << lt << " = " << val << " < " << targets[mid].first << endl;
+        outcode << "if " << lt << " goto " << left_label << endl;
+        emit_search(outcode, temp_count, label_count, val, targets, mid + 1, hi, default_label);
+
+        outcode << left_label << ":" << endl;
+        emit_search(outcode, temp_count, label_count, val, targets, lo, mid, default_label);
+    }
+
+    // Bounds check, then one indexed jump through a table of labels
+    void emit_table(ostream& outcode, int& temp_count, const string& val,
+                    const vector<pair<int64_t, string>>& targets, const string& default_label) const {
+        int64_t low = targets.front().first;
+        int64_t high = targets.back().first;
+
+        string below = "t" + to_string(temp_count++);
+        outcode << below << " = " << val << " < " << low << endl;
+        outcode << "if " << below << " goto " << default_label << endl;
+        string above = "t" + to_string(temp_count++);
+        outcode << above << " = " << val << " > " << high << endl;
+        outcode << "if " << above << " goto " << default_label << endl;
+
+        string index = val;
+        if (low != 0) {
+            index = "t" + to_string(temp_count++);
+            outcode << index << " = " << val << " - " << low << endl;
+        }
+
+        // A 64-bit offset from low, a loop over the values themselves never ends when high is the largest int
+        uint64_t span = (uint64_t)high - (uint64_t)low;
+        outcode << "jump_table " << index << " :";
+        size_t next = 0;
+        for (uint64_t i = 0; i <= span; i++) {
+            if ((uint64_t)targets[next].first - (uint64_t)low == i) outcode << " " << targets[next++].second;
+            else outcode << " " << default_label; // hole in the table
+            if (i != span) outcode << ",";
+        }
+        outcode << endl;
+    }
+
+public:
+    SwitchNode() : condition(nullptr) {}
+    
+    ~SwitchNode() {
+        if (condition) delete condition;
+        for (auto c : cases) delete c;
+    }
+    
+    void set_condition(ExprNode* cond) { condition = cond; }
+    
+    void add_case(CaseNode* c) { if (c) cases.push_back(c); }
+    
+    ExprNode* get_condition() const { return condition; }
+    const vector<CaseNode*>& get_cases() const { return cases; }
+    
+    string generate_code(ostream& outcode, map<string, string>& symbol_to_temp,
+                        int& temp_count, int& label_count) const override {
+        string val = condition->generate_code(outcode, symbol_to_temp, temp_count, label_count);
+
+        vector<string> case_labels;
+        vector<pair<int64_t, string>> targets; // (value, label) sorted by value
+        string end_label = "L" + to_string(label_count++);
+        string default_label = end_label;
+        for (auto c : cases) {
+            string label = "L" + to_string(label_count++);
+            case_labels.push_back(label);
+            if (c->get_is_default()) default_label = label;
+            else targets.push_back(make_pair(c->get_value(), label));
+        }
+        sort(targets.begin(), targets.end());
+
+        if (targets.size() <= LINEAR_MAX_CASES) {
+            emit_linear(outcode, temp_count, val, targets, 0, targets.size());
+            outcode << "goto " << default_label << endl;
+        } else if (table_fits(targets)) {
+            emit_table(outcode, temp_count, val, targets, default_label);
+        } else {
+            emit_search(outcode, temp_count, label_count, val, targets, 0, targets.size(), default_label);
+        }
+
+        jump_targets.push_back(make_pair(end_label, ""));
+        for (size_t i = 0; i < cases.size(); i++) {
+            outcode << case_labels[i] << ":" << endl;
+            symbol_to_temp.clear(); // reached from the dispatch or by falling through
+            cases[i]->generate_code(outcode, symbol_to_temp, temp_count, label_count);
+        }
+        jump_targets.pop_back();
+        outcode << end_label << ":" << endl;
+        symbol_to_temp.clear();
+
+        return "";
+    }
+};
+
+// Break statement node, jumps past the innermost loop or switch
+
+class BreakNode : public StmtNode {
+public:
+    string generate_code(ostream& outcode, map<string, string>& symbol_to_temp,
+                        int& temp_count, int& label_count) const override {
+        if (!jump_targets.empty()) outcode << "goto " << jump_targets.back().first << endl;
+        return "";
+    }
+};
+
+// Continue statement node, jumps to the next iteration of the innermost loop
+
+class ContinueNode : public StmtNode {
+public:
+    string generate_code(ostream& outcode, map<string, string>& symbol_to_temp,
+                        int& temp_count, int& label_count) const override {
+        for (auto it = jump_targets.rbegin(); it != jump_targets.rend(); ++it) {
+            if (it->second != "") { // skip enclosing switches
+                outcode << "goto " << it->second << endl;
+                break;
+            }
+        }
+        return "";
+    }
+};
+
 // Return statement node
 
 class ReturnNode : public StmtNode {
@@ -379,7 +755,9 @@ public:
     ReturnNode(ExprNode* e) : expr(e) {}
     ~ReturnNode() { if (expr) delete expr; }
     
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
+    ExprNode* get_expr() const { return expr; }
+    
+    string generate_code(ostream& outcode, map<string, string>& symbol_to_temp,
                         int& temp_count, int& label_count) const override {
         if (expr) {
             string val = expr->generate_code(outcode, symbol_to_temp, temp_count, label_count);
@@ -397,20 +775,84 @@ class DeclNode : public StmtNode {
 private:
     string type;
     vector<pair<string, int>> vars; // Variable name and array size (0 for regular vars)
+    vector<ExprNode*> size_exprs; // Array size as written, nullptr for regular vars, folded by semantic analysis
+    vector<vector<ExprNode*>> inits; // Initial values of each variable, empty when not initialized
+    vector<bool> braced; // Initializer was a brace-enclosed list
+    bool global; // Globals are static data, their initial values are folded into the data section
+
+    string format_value(const const_value& v) const {
+        if (type == "int") return to_string(v.as_int());
+        return format_float(v.as_double());
+    }
 
 public:
-    DeclNode(string t) : type(t) {}
+    DeclNode(string t) : type(t), global(false) {}
+    
+    ~DeclNode() {
+        for (auto size : size_exprs) if (size) delete size;
+        for (auto& values : inits) {
+            for (auto value : values) delete value;
+        }
+    }
+    
+    void add_var(string name, ExprNode* size_expr = nullptr, vector<ExprNode*> init_values = {}, bool brace_list = false) {
+        vars.push_back(make_pair(name, 0));
+        size_exprs.push_back(size_expr);
+        inits.push_back(init_values);
+        braced.push_back(brace_list);
+    }
     
-    void add_var(string name, int array_size = 0) {
-        vars.push_back(make_pair(name, array_size));
+    void set_global(bool g) { global = g; }
+    bool is_global() const { return global; }
+    void set_type(string t) { type = t; }
+    void set_array_size(size_t i, int size) { vars[i].second = size; }
+    ExprNode* get_size_expr(size_t i) const { return size_exprs[i]; }
+    const vector<ExprNode*>& get_inits(size_t i) const { return inits[i]; }
+    bool is_braced(size_t i) const { return braced[i]; }
+    
+    // Data section entry for every initialized global, remaining array elements are zero
+    void generate_data(ostream& outcode) const {
+        if (!global) return;
+        for (size_t i = 0; i < vars.size(); i++) {
+            if (inits[i].empty()) continue;
+            outcode << "data " << type << " " << vars[i].first;
+            if (vars[i].second > 0) outcode << "[" << vars[i].second << "]";
+            outcode << " =";
+            for (size_t j = 0; j < inits[i].size(); j++) {
+                const_value v;
+                inits[i][j]->evaluate_const(v);
+                outcode << " " << format_value(v);
+                if (j + 1 < inits[i].size()) outcode << ",";
+            }
+            outcode << endl;
+        }
     }
     
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
+    string generate_code(ostream& outcode, map<string, string>& symbol_to_temp,
                         int& temp_count, int& label_count) const override {
-        for (auto& v : vars) {
+        for (size_t i = 0; i < vars.size(); i++) {
+            auto& v = vars[i];
             outcode << "// Declaration: " << type << " " << v.first;
             if (v.second > 0) outcode << "[" << v.second << "]"; //arraytype
             outcode << endl;
+
+            if (global) continue; // initial values are in the data section
+            for (size_t j = 0; j < inits[i].size(); j++) { // local initializers are plain stores
+                string val = inits[i][j]->generate_code(outcode, symbol_to_temp, temp_count, label_count);
+                if (v.second > 0) {
+                    outcode << v.first << "[" << j << "] = " << val << endl;
+                } else {
+                    outcode << v.first << " = " << val << endl;
+                    symbol_to_temp[v.first] = val;
+                }
+            }
+            if (v.second > 0 && braced[i] && inits[i].size() < (size_t)v.second) { // as in C, the rest are zero
+                string zero = "t" + to_string(temp_count++);
+                outcode << zero << " = " << (type == "float" ? format_float(0) : "0") << endl;
+                for (size_t j = inits[i].size(); j < (size_t)v.second; j++) {
+                    outcode << v.first << "[" << j << "] = " << zero << endl;
+                }
+            }
         }
         return "";
     }
@@ -425,7 +867,7 @@ class FuncDeclNode : public ASTNode {
 private:
     string return_type; 
     string name; 
-    vector<pair<string, string>> params; 
+    vector<pair<string, string>> params; // (type, name), name is "_null_" when not given
     BlockNode* body; 
 
 public:
@@ -440,12 +882,21 @@ public:
         body = b;
     }
     
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
+    string get_return_type() const { return return_type; }
+    string get_name() const { return name; }
+    const vector<pair<string, string>>& get_params() const { return params; }
+    BlockNode* get_body() const { return body; }
+    
+    string generate_code(ostream& outcode, map<string, string>& symbol_to_temp,
                         int& temp_count, int& label_count) const override {
+        trace_span span("tac", "generate_code ", name);
         outcode << "// Function: " << return_type << " " << name << "("; // Header comment
-        for (size_t i = 0; i < params.size(); i++) { // List parameters
-            outcode << params[i].first << " " << params[i].second;
-            if (i + 1 < params.size()) outcode << ", ";
+        bool first = true;
+        for (auto& param : params) { // List named parameters
+            if (param.second == "_null_") continue;
+            if (!first) outcode << ", ";
+            outcode << param.first << " " << param.second;
+            first = false;
         }
         outcode << ")" << endl;
 
@@ -453,6 +904,7 @@ public:
         symbol_to_temp.clear(); 
 
         if (body) body->generate_code(outcode, symbol_to_temp, temp_count, label_count); 
+        else outcode << "// Body not analyzed (lazy mode)" << endl; // never reached from main
 
         outcode << endl; 
         return "";
@@ -489,7 +941,29 @@ public:
         return args;
     }
     
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
+    string generate_code(ostream& outcode, map<string, string>& symbol_to_temp,
+                        int& temp_count, int& label_count) const override {
+        // This node doesn't generate code directly
+        return "";
+    }
+};
+
+// Helper class for parameter lists, moved into FuncDeclNode
+
+class ParameterListNode : public ASTNode {
+private:
+    vector<pair<string, string>> params; // (type, name), name is "_null_" when not given
+
+public:
+    void add_param(string type, string name) {
+        params.push_back(make_pair(type, name));
+    }
+    
+    const vector<pair<string, string>>& get_params() const {
+        return params;
+    }
+    
+    string generate_code(ostream& outcode, map<string, string>& symbol_to_temp,
                         int& temp_count, int& label_count) const override {
         // This node doesn't generate code directly
         return "";
@@ -504,8 +978,8 @@ private:
     vector<ExprNode*> arguments;
 
 public:
-    FuncCallNode(string name, string result_type)
-        : ExprNode(result_type), func_name(name) {}
+    FuncCallNode(string name)
+        : func_name(name) {}
     
     ~FuncCallNode() {
         for (auto arg : arguments) {
@@ -513,11 +987,14 @@ public:
         }
     }
     
+    string get_name() const { return func_name; }
+    const vector<ExprNode*>& get_arguments() const { return arguments; }
+    
     void add_argument(ExprNode* arg) {
         if (arg) arguments.push_back(arg);
     }
     
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
+    string generate_code(ostream& outcode, map<string, string>& symbol_to_temp,
                         int& temp_count, int& label_count) const override {
         for (auto arg : arguments) {
             string arg_temp;
@@ -537,11 +1014,13 @@ public:
 
         if (node_type == "void") { //print returns nothing
             outcode << "call " << func_name << ", " << arguments.size() << endl;
+            symbol_to_temp.clear(); // the callee may have written globals
             return "";
         }
 
         string temp = "t" + to_string(temp_count++);
         outcode << temp << " = call " << func_name << ", " << arguments.size() << endl;
+        symbol_to_temp.clear(); // the callee may have written globals
         return temp;
     }
 };
@@ -563,7 +1042,15 @@ public:
         if (unit) units.push_back(unit);
     }
     
-    string generate_code(ofstream& outcode, map<string, string>& symbol_to_temp,
+    const vector<ASTNode*>& get_units() const { return units; }
+    
+    void generate_data(ostream& outcode) const {
+        for (auto unit : units) {
+            if (auto decl = dynamic_cast<DeclNode*>(unit)) decl->generate_data(outcode);
+        }
+    }
+    
+    string generate_code(ostream& outcode, map<string, string>& symbol_to_temp,
                         int& temp_count, int& label_count) const override {
         for (auto unit : units) {
             if (unit) unit->generate_code(outcode, symbol_to_temp, temp_count, label_count);
@@ -0,0 +1,65 @@
+#ifndef BENCH_STATS_H
+#define BENCH_STATS_H
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace std;
+
+// Summary of repeated measurements, shared by benchmark and compare.
+// Intervals use Student's t, runs are few and their spread is unknown.
+
+// Two-sided 95% quantile of Student's t with df degrees of freedom
+inline double t_quantile_95(double df)
+{
+    static const double table[] = {0, 12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                                   2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                                   2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+    if (df < 1) return INFINITY;
+    if (df <= 30) return table[(int)df];
+    return 1.96 + 2.4 / df; // close to the table from 30 up, 1.96 in the limit
+}
+
+struct sample_stats
+{
+    int n = 0;
+    double mean = 0, stddev = 0, ci_low = 0, ci_high = 0;
+
+    sample_stats() {}
+
+    sample_stats(const vector<double>& samples)
+    {
+        n = samples.size();
+        if (n == 0) return;
+        for (double s : samples) mean += s;
+        mean /= n;
+        for (double s : samples) stddev += (s - mean) * (s - mean);
+        stddev = n > 1 ? sqrt(stddev / (n - 1)) : 0;
+        double half = n > 1 ? t_quantile_95(n - 1) * stddev / sqrt(n) : 0;
+        ci_low = mean - half;
+        ci_high = mean + half;
+    }
+};
+
+// 95% interval of new.mean - old.mean by Welch's t, for unequal spreads.
+// A side with fewer than 2 runs has no spread to go on: the interval is
+// unbounded and the result false, so no change can be called significant.
+inline bool welch_interval(const sample_stats& old_run, const sample_stats& new_run, double& low, double& high)
+{
+    double diff = new_run.mean - old_run.mean;
+    if (old_run.n < 2 || new_run.n < 2)
+    {
+        low = -INFINITY;
+        high = INFINITY;
+        return false;
+    }
+    double a = old_run.stddev * old_run.stddev / old_run.n, b = new_run.stddev * new_run.stddev / new_run.n;
+    double se = sqrt(a + b);
+    double df = se == 0 ? old_run.n + new_run.n - 2 : (a + b) * (a + b) / (a * a / (old_run.n - 1) + b * b / (new_run.n - 1));
+    low = diff - t_quantile_95(df) * se;
+    high = diff + t_quantile_95(df) * se;
+    return true;
+}
+
+#endif // BENCH_STATS_H
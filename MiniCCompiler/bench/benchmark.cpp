@@ -0,0 +1,335 @@
+// Benchmarks of the compiler, written as one JSON result file.
+//
+//   startup            the compiler run without an input: process start, static initialization and exit, ms
+//   compile/NAME       end-to-end run of the compiler on an input, ms
+//   symbol_table/...   insert, lookup and scope churn on symbol_table, ns per operation
+//   execute/NAME       running the generated code with tac_executor, ms
+//   output/stream|mmap writing 64 MB of TAC lines to code.txt the two ways output_file can, ms;
+//                      output/stream_endl ends every line with endl as the code generator does
+//
+// Every benchmark is run --runs times after one warm-up run. The file keeps
+// all samples next to their mean and 95% interval, with the git revision and
+// the machine, so results can be compared later with compare.
+//
+// Build: g++ -std=c++17 -O2 -pthread -o benchmark bench/benchmark.cpp
+// Usage: benchmark [--compiler=PATH] [--runs=N] [--filter=TEXT] [--out=FILE] [INPUT.c...]
+
+#include "bench_stats.h"
+#include "../symbol_table.h"
+#include "../tac_executor.h"
+#include "../output_file.h"
+
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <fcntl.h>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <spawn.h>
+#include <sstream>
+#include <string>
+#include <sys/utsname.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace std;
+
+extern char** environ;
+
+static const char* SCHEMA = "minic-bench-1";
+
+struct benchmark_result
+{
+    string name, unit;
+    vector<double> samples;
+};
+
+static string json_string(const string& text)
+{
+    string out = "\"";
+    for (char c : text)
+    {
+        if (c == '"' || c == '\\') out += '\\';
+        if ((unsigned char)c < 0x20) out += ' ';
+        else out += c;
+    }
+    return out + "\"";
+}
+
+// First line of a command's output, "" when it fails
+static string command_output(const string& command)
+{
+    FILE* pipe = popen((command + " 2>/dev/null").c_str(), "r");
+    if (!pipe) return "";
+    char line[512] = "";
+    if (!fgets(line, sizeof(line), pipe)) line[0] = 0;
+    pclose(pipe);
+    string out = line;
+    while (out != "" && (out.back() == '\n' || out.back() == '\r')) out.pop_back();
+    return out;
+}
+
+static string cpu_model()
+{
+    ifstream cpuinfo("/proc/cpuinfo");
+    string line;
+    while (getline(cpuinfo, line))
+    {
+        if (line.rfind("model name", 0) == 0) return line.substr(line.find(':') + 2);
+    }
+    return "unknown";
+}
+
+static double elapsed_ms(chrono::steady_clock::time_point since)
+{
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - since).count();
+}
+
+// Runs the compiler without a shell in between, output goes to /dev/null.
+// An empty input runs it without arguments.
+static bool run_compiler(const string& compiler, const string& input)
+{
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_addopen(&actions, 1, "/dev/null", O_WRONLY, 0);
+    posix_spawn_file_actions_addopen(&actions, 2, "/dev/null", O_WRONLY, 0);
+    char* argv[] = {(char*)compiler.c_str(), input == "" ? NULL : (char*)input.c_str(), NULL};
+    pid_t pid;
+    int status = -1;
+    if (posix_spawn(&pid, compiler.c_str(), &actions, NULL, argv, environ) == 0) waitpid(pid, &status, 0);
+    posix_spawn_file_actions_destroy(&actions);
+    return status == 0;
+}
+
+static benchmark_result measure(const string& name, const string& unit, int runs, const function<double()>& sample)
+{
+    benchmark_result result{name, unit, {}};
+    sample(); // warm-up: page cache, allocator, branch predictors
+    for (int i = 0; i < runs; i++) result.samples.push_back(sample());
+    return result;
+}
+
+// ns per operation of ops operations done by body
+static double per_op_ns(int ops, const function<void()>& body)
+{
+    auto start = chrono::steady_clock::now();
+    body();
+    return elapsed_ms(start) * 1e6 / ops;
+}
+
+int main(int argc, char* argv[])
+{
+    string compiler = "./two_pass_compiler", filter, out_file = "bench_results.json";
+    int runs = 10;
+    vector<string> inputs;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg.rfind("--compiler=", 0) == 0) compiler = arg.substr(11);
+        else if (arg.rfind("--runs=", 0) == 0) runs = max(2, stoi(arg.substr(7)));
+        else if (arg.rfind("--filter=", 0) == 0) filter = arg.substr(9);
+        else if (arg.rfind("--out=", 0) == 0) out_file = arg.substr(6);
+        else inputs.push_back(arg);
+    }
+    if (inputs.empty()) inputs = {"tests/cases/stress_functions.c", "tests/cases/sample_input.c", "bench/inputs/loops.c"};
+
+    // The compiler writes its outputs to the working directory, keep them out of the tree
+    char* absolute = realpath(compiler.c_str(), NULL);
+    if (absolute == NULL)
+    {
+        cout << "No compiler at " << compiler << endl;
+        return 2;
+    }
+    compiler = absolute;
+    free(absolute);
+    for (string& input : inputs)
+    {
+        absolute = realpath(input.c_str(), NULL);
+        if (absolute == NULL)
+        {
+            cout << "No input " << input << endl;
+            return 2;
+        }
+        input = absolute;
+        free(absolute);
+    }
+    if (out_file[0] != '/')
+    {
+        char* cwd = getcwd(NULL, 0);
+        out_file = string(cwd) + "/" + out_file;
+        free(cwd);
+    }
+    string revision = command_output("git rev-parse HEAD");
+    bool dirty = command_output("git status --porcelain --untracked-files=no") != "";
+    char scratch[] = "/tmp/benchmark.XXXXXX";
+    string work_dir = mkdtemp(scratch);
+    if (chdir(work_dir.c_str()) != 0) return 2;
+
+    vector<benchmark_result> results;
+    auto wanted = [&](const string& name) { return filter == "" || name.find(filter) != string::npos; };
+
+    if (wanted("startup"))
+    {
+        results.push_back(measure("startup", "ms", runs, [&]() {
+            auto start = chrono::steady_clock::now();
+            run_compiler(compiler, "");
+            return elapsed_ms(start);
+        }));
+    }
+
+    for (const string& input : inputs)
+    {
+        string base = input.substr(input.rfind('/') + 1);
+        base = base.substr(0, base.rfind('.'));
+
+        string name = "compile/" + base;
+        if (wanted(name))
+        {
+            results.push_back(measure(name, "ms", runs, [&]() {
+                auto start = chrono::steady_clock::now();
+                run_compiler(compiler, input);
+                return elapsed_ms(start);
+            }));
+        }
+
+        // Only programs that compile and have a main can be executed
+        name = "execute/" + base;
+        if (!wanted(name) || !run_compiler(compiler, input)) continue;
+        ifstream code_file("code.txt");
+        stringstream code;
+        code << code_file.rdbuf();
+        try
+        {
+            tac_executor probe;
+            istringstream text(code.str());
+            probe.load(text);
+            ostringstream ignored;
+            probe.run(ignored);
+        }
+        catch (const runtime_error&)
+        {
+            continue;
+        }
+        results.push_back(measure(name, "ms", runs, [&]() {
+            auto start = chrono::steady_clock::now();
+            tac_executor executor;
+            istringstream text(code.str());
+            executor.load(text);
+            ostringstream ignored;
+            executor.run(ignored);
+            return elapsed_ms(start);
+        }));
+    }
+
+    // Output throughput. The stream and the mapping are compared on plain '\n'
+    // lines; with endl every line is a flush, a write call for the stream
+    for (string name : {"output/stream", "output/mmap", "output/stream_endl"})
+    {
+        if (!wanted(name)) continue;
+        bool mapped = name == "output/mmap", flush_lines = name == "output/stream_endl";
+        results.push_back(measure(name, "ms", runs, [&]() {
+            auto start = chrono::steady_clock::now();
+            output_file out;
+            out.open("code.txt", mapped);
+            for (int i = 0; i < (1 << 22); i++)
+            {
+                out << "t" << i % 1000 << " = t" << i % 997 << " + 1";
+                if (flush_lines) out << endl;
+                else out << '\n';
+            }
+            out.close();
+            return elapsed_ms(start);
+        }));
+    }
+
+    // Symbol table operations, scope dumps go nowhere
+    ostream nowhere(nullptr);
+    const int symbols = 2000;
+    vector<string> names;
+    for (int i = 0; i < symbols; i++) names.push_back("v" + to_string(i * 7919 % 100003));
+
+    if (wanted("symbol_table/insert"))
+    {
+        results.push_back(measure("symbol_table/insert", "ns/op", runs, [&]() {
+            symbol_table table;
+            table.enter_scope(nowhere);
+            return per_op_ns(symbols, [&]() {
+                for (auto& n : names) table.Insert_in_table(n, "ID");
+            });
+        }));
+    }
+    if (wanted("symbol_table/lookup"))
+    {
+        symbol_table table;
+        table.enter_scope(nowhere);
+        for (auto& n : names) table.Insert_in_table(n, "ID");
+        for (int depth = 0; depth < 8; depth++) table.enter_scope(nowhere); // found in the outermost scope
+        results.push_back(measure("symbol_table/lookup", "ns/op", runs, [&]() {
+            return per_op_ns(symbols, [&]() {
+                for (auto& n : names) table.Lookup_in_table(n);
+            });
+        }));
+    }
+    if (wanted("symbol_table/scope_churn"))
+    {
+        results.push_back(measure("symbol_table/scope_churn", "ns/op", runs, [&]() {
+            symbol_table table;
+            table.enter_scope(nowhere);
+            const int scopes = 2000;
+            return per_op_ns(scopes, [&]() {
+                for (int s = 0; s < scopes; s++)
+                {
+                    table.enter_scope(nowhere);
+                    table.Insert_in_table(names[s % symbols], "ID");
+                    table.Insert_in_table(names[(s + 1) % symbols], "ID");
+                    table.Lookup_in_table(names[s % symbols]);
+                    table.exit_scope(nowhere);
+                }
+            });
+        }));
+    }
+
+    // Machine and revision first, then every benchmark with its samples
+    utsname os;
+    uname(&os);
+    char host[256] = "";
+    gethostname(host, sizeof(host) - 1);
+    char date[32];
+    time_t now = time(NULL);
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+
+    ofstream out(out_file);
+    out << setprecision(6);
+    out << "{\n";
+    out << "  \"schema\": " << json_string(SCHEMA) << ",\n";
+    out << "  \"date\": " << json_string(date) << ",\n";
+    out << "  \"git\": {\"revision\": " << json_string(revision) << ", \"dirty\": " << (dirty ? "true" : "false") << "},\n";
+    out << "  \"machine\": {\"hostname\": " << json_string(host) << ", \"cpu\": " << json_string(cpu_model())
+        << ", \"cores\": " << thread::hardware_concurrency() << ", \"os\": "
+        << json_string(string(os.sysname) + " " + os.release + " " + os.machine)
+        << ", \"compiler\": " << json_string(__VERSION__) << "},\n";
+    out << "  \"runs\": " << runs << ",\n";
+    out << "  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const benchmark_result& r = results[i];
+        sample_stats stats(r.samples);
+        out << "    {\"name\": " << json_string(r.name) << ", \"unit\": " << json_string(r.unit) << ", \"samples\": [";
+        for (size_t s = 0; s < r.samples.size(); s++) out << (s ? ", " : "") << r.samples[s];
+        out << "], \"mean\": " << stats.mean << ", \"stddev\": " << stats.stddev << ", \"ci95\": [" << stats.ci_low
+            << ", " << stats.ci_high << "]}" << (i + 1 < results.size() ? "," : "") << "\n";
+        cout << left << setw(36) << r.name << right << setw(12) << fixed << setprecision(3) << stats.mean << " " << setw(6)
+             << left << r.unit << right << " +- " << (stats.ci_high - stats.mean) << endl;
+    }
+    out << "  ]\n}\n";
+
+    remove((work_dir + "/code.txt").c_str());
+    remove((work_dir + "/error.txt").c_str());
+    remove((work_dir + "/log.txt").c_str());
+    rmdir(work_dir.c_str());
+    return out ? 0 : 1;
+}
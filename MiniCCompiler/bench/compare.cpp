@@ -0,0 +1,252 @@
+// Compares two result files of benchmark.
+//
+// For every benchmark in both files it prints the old and new mean with their
+// 95% intervals and the change. A change is reported as slower or faster only
+// when Welch's interval of the difference excludes zero and the change is at
+// least --threshold percent (2 by default); everything else is noise. With
+// fewer than 2 runs on either side there is no interval, such a benchmark is
+// reported as having insufficient runs instead of being judged.
+// Differences in schema, machine or compiler are printed first, since they
+// make the numbers hard to compare.
+//
+// Build: g++ -std=c++17 -O2 -o compare bench/compare.cpp
+// Usage: compare [--threshold=PERCENT] OLD.json NEW.json
+// Exits with 1 when a benchmark got significantly slower.
+
+#include "bench_stats.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Just enough JSON for the files benchmark writes
+struct json_value
+{
+    enum kind_t { NUL, BOOL, NUMBER, STRING, ARRAY, OBJECT } kind = NUL;
+    double number = 0;
+    string text;
+    vector<json_value> items;
+    map<string, json_value> fields;
+
+    const json_value& operator[](const string& key) const
+    {
+        static const json_value missing;
+        auto it = fields.find(key);
+        return it == fields.end() ? missing : it->second;
+    }
+};
+
+class json_parser
+{
+    const string& in;
+    size_t pos = 0;
+
+    void skip_space()
+    {
+        while (pos < in.size() && isspace((unsigned char)in[pos])) pos++;
+    }
+
+    void expect(char c)
+    {
+        skip_space();
+        if (pos >= in.size() || in[pos] != c) throw runtime_error(string("expected '") + c + "' at offset " + to_string(pos));
+        pos++;
+    }
+
+    string parse_string()
+    {
+        expect('"');
+        string out;
+        while (pos < in.size() && in[pos] != '"')
+        {
+            if (in[pos] == '\\') pos++;
+            out += in[pos++];
+        }
+        expect('"');
+        return out;
+    }
+
+public:
+    json_parser(const string& text) : in(text) {}
+
+    json_value parse()
+    {
+        json_value v;
+        skip_space();
+        if (pos >= in.size()) throw runtime_error("unexpected end");
+        char c = in[pos];
+        if (c == '{')
+        {
+            v.kind = json_value::OBJECT;
+            pos++;
+            skip_space();
+            if (in[pos] == '}') return pos++, v;
+            do
+            {
+                string key = parse_string();
+                expect(':');
+                v.fields[key] = parse();
+                skip_space();
+            } while (in[pos] == ',' && ++pos);
+            expect('}');
+        }
+        else if (c == '[')
+        {
+            v.kind = json_value::ARRAY;
+            pos++;
+            skip_space();
+            if (in[pos] == ']') return pos++, v;
+            do
+            {
+                v.items.push_back(parse());
+                skip_space();
+            } while (in[pos] == ',' && ++pos);
+            expect(']');
+        }
+        else if (c == '"')
+        {
+            v.kind = json_value::STRING;
+            v.text = parse_string();
+        }
+        else if (in.compare(pos, 4, "true") == 0 || in.compare(pos, 5, "false") == 0)
+        {
+            v.kind = json_value::BOOL;
+            v.number = in[pos] == 't';
+            pos += in[pos] == 't' ? 4 : 5;
+        }
+        else if (in.compare(pos, 4, "null") == 0)
+        {
+            pos += 4;
+        }
+        else
+        {
+            v.kind = json_value::NUMBER;
+            size_t used = 0;
+            v.number = stod(in.substr(pos, 32), &used);
+            pos += used;
+        }
+        return v;
+    }
+};
+
+static json_value load(const string& path)
+{
+    ifstream file(path);
+    if (!file) throw runtime_error("cannot read " + path);
+    stringstream text;
+    text << file.rdbuf();
+    json_value root = json_parser(text.str()).parse();
+    if (root["schema"].text.rfind("minic-bench-", 0) != 0) throw runtime_error(path + " is not a benchmark result file");
+    return root;
+}
+
+// Mean and half the 95% interval, a single run has no interval to show
+static string summary(const sample_stats& stats)
+{
+    char text[64];
+    if (stats.n < 2) snprintf(text, sizeof(text), "%.3f (%d run)", stats.mean, stats.n);
+    else snprintf(text, sizeof(text), "%.3f +- %.3f", stats.mean, stats.ci_high - stats.mean);
+    return text;
+}
+
+static sample_stats stats_of(const json_value& benchmark)
+{
+    vector<double> samples;
+    for (const json_value& s : benchmark["samples"].items) samples.push_back(s.number);
+    return sample_stats(samples);
+}
+
+int main(int argc, char* argv[])
+{
+    double threshold = 2;
+    vector<string> files;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg.rfind("--threshold=", 0) == 0) threshold = stod(arg.substr(12));
+        else files.push_back(arg);
+    }
+    if (files.size() != 2)
+    {
+        cout << "Usage: compare [--threshold=PERCENT] OLD.json NEW.json" << endl;
+        return 2;
+    }
+
+    json_value old_run, new_run;
+    try
+    {
+        old_run = load(files[0]);
+        new_run = load(files[1]);
+    }
+    catch (const exception& e)
+    {
+        cout << "compare: " << e.what() << endl;
+        return 2;
+    }
+
+    auto revision = [](const json_value& run) {
+        string rev = run["git"]["revision"].text.substr(0, 12);
+        return (rev == "" ? "unknown" : rev) + (run["git"]["dirty"].number ? "+dirty" : "");
+    };
+    cout << "old: " << revision(old_run) << " " << old_run["date"].text << endl;
+    cout << "new: " << revision(new_run) << " " << new_run["date"].text << endl;
+
+    if (old_run["schema"].text != new_run["schema"].text)
+        cout << "warning: schema " << old_run["schema"].text << " vs " << new_run["schema"].text << endl;
+    for (string key : {"hostname", "cpu", "cores", "os", "compiler"})
+    {
+        const json_value &a = old_run["machine"][key], &b = new_run["machine"][key];
+        if (a.text != b.text || a.number != b.number)
+        {
+            auto show = [](const json_value& v) { return v.kind == json_value::NUMBER ? to_string((int)v.number) : v.text; };
+            cout << "warning: machine " << key << " differs: " << show(a) << " vs " << show(b) << endl;
+        }
+    }
+    cout << endl;
+
+    map<string, const json_value*> old_benchmarks;
+    for (const json_value& b : old_run["benchmarks"].items) old_benchmarks[b["name"].text] = &b;
+
+    int slower = 0, faster = 0, unjudged = 0;
+    printf("%-30s %22s %22s %9s\n", "benchmark", "old", "new", "change");
+    for (const json_value& b : new_run["benchmarks"].items)
+    {
+        string name = b["name"].text;
+        auto it = old_benchmarks.find(name);
+        if (it == old_benchmarks.end())
+        {
+            printf("%-30s %22s %22s %9s\n", name.c_str(), "-", "new", "");
+            continue;
+        }
+        sample_stats before = stats_of(*it->second), after = stats_of(b);
+        old_benchmarks.erase(it);
+
+        double low, high;
+        bool judged = welch_interval(before, after, low, high);
+        double change = before.mean == 0 ? 0 : 100 * (after.mean - before.mean) / before.mean;
+        string verdict = judged ? "" : "insufficient runs";
+        if (!judged) unjudged++;
+        else if ((low > 0 || high < 0) && (change >= threshold || change <= -threshold))
+        {
+            verdict = change > 0 ? "slower" : "faster";
+            (change > 0 ? slower : faster)++;
+        }
+
+        printf("%-30s %22s %22s %+8.1f%%  %s\n", name.c_str(), summary(before).c_str(), summary(after).c_str(), change,
+               verdict.c_str());
+    }
+    for (auto& gone : old_benchmarks) printf("%-30s %22s %22s\n", gone.first.c_str(), "old", "-");
+
+    cout << endl << slower << " slower, " << faster << " faster";
+    if (unjudged) cout << ", " << unjudged << " with insufficient runs";
+    cout << endl;
+    return slower ? 1 : 0;
+}
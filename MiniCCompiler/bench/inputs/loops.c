@@ -0,0 +1,37 @@
+int table[64];
+int total;
+
+int mix(int a, int b) {
+    int r;
+    r = a * 31 + b;
+    if (r > 100000) r = r % 9973;
+    return r;
+}
+
+void fill(int seed) {
+    int i;
+    for (i = 0; i < 64; i++) {
+        table[i] = mix(seed, i);
+    }
+}
+
+int main() {
+    int round, i, j, acc;
+    acc = 0;
+    for (round = 0; round < 200; round++) {
+        fill(round);
+        for (i = 0; i < 64; i++) {
+            for (j = 0; j < 8; j++) {
+                if (table[i] % 2 == 0) acc = acc + table[i] / (j + 1);
+                else acc = acc - j;
+            }
+        }
+        switch (round % 3) {
+            case 0: acc = acc % 100003; break;
+            case 1: acc = acc + 7; break;
+            default: acc = acc * 3 % 100003;
+        }
+    }
+    total = acc;
+    return acc % 256;
+}
@@ -0,0 +1,263 @@
+#ifndef DIAGNOSTICS_H
+#define DIAGNOSTICS_H
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <set>
+#include <tuple>
+#include <cerrno>
+#include <csignal>
+#include <unistd.h>
+
+using namespace std;
+
+// Every message the compiler can report. The text lives in diag_table, a
+// diagnostic itself only records its code, line and arguments.
+enum diag_code
+{
+    DIAG_SYNTAX_ERROR,
+    DIAG_PARAM_NAME_MISSING,
+    DIAG_MULTIPLE_FUNC_DECL,
+    DIAG_RETURN_TYPE_MISMATCH,
+    DIAG_MULTIPLE_PARAM_DECL,
+    DIAG_VOID_VARIABLE,
+    DIAG_SCALAR_BRACES,
+    DIAG_MULTIPLE_VAR_DECL,
+    DIAG_ARRAY_NEEDS_BRACES,
+    DIAG_EXCESS_INITIALIZERS,
+    DIAG_VOID_OPERATION,
+    DIAG_VOID_OPERAND,
+    DIAG_FLOAT_TO_INT,
+    DIAG_NON_CONSTANT_INIT,
+    DIAG_BAD_ARRAY_SIZE,
+    DIAG_NESTED_FUNC_DEF,
+    DIAG_SWITCH_NOT_INT,
+    DIAG_BREAK_OUTSIDE,
+    DIAG_CONTINUE_OUTSIDE,
+    DIAG_UNDECLARED_VARIABLE,
+    DIAG_MULTIPLE_DEFAULT,
+    DIAG_DUPLICATE_CASE,
+    DIAG_VARIABLE_IS_ARRAY,
+    DIAG_VARIABLE_IS_FUNC,
+    DIAG_NOT_ARRAY,
+    DIAG_INDEX_NOT_INT,
+    DIAG_MODULUS_BY_ZERO,
+    DIAG_MODULUS_NOT_INT,
+    DIAG_DIVIDE_BY_ZERO,
+    DIAG_UNDECLARED_FUNC,
+    DIAG_UNDEFINED_FUNC,
+    DIAG_ARG_COUNT,
+    DIAG_ARG_TYPE,
+    DIAG_INVALID_INTEGER,
+    DIAG_INTEGER_RANGE,
+    DIAG_FLOAT_RANGE,
+    DIAG_ARRAY_TOO_LARGE,
+    DIAG_OUTPUT_FAILED,
+};
+
+struct diag_info
+{
+    const char* name;   // stable identifier for machine readable output
+    const char* format; // %s takes the next symbol argument, %d the number
+    bool warning;
+    bool once_per_function; // repeats inside one function are cascades
+};
+
+// Indexed by diag_code
+static const diag_info diag_table[] = {
+    {"syntax-error", "%s", false, false},
+    {"param-name-missing", "Parameter %d's name not given in function definition of %s", false, false},
+    {"multiple-func-decl", "Multiple declaration of function %s", false, false},
+    {"return-type-mismatch", "Return type mismatch of function %s", false, false},
+    {"multiple-param-decl", "Multiple declaration of variable %s in parameter of %s", false, false},
+    {"void-variable", "variable type can not be void ", false, false},
+    {"scalar-braces", "braces around scalar initializer of %s", false, false},
+    {"multiple-var-decl", "Multiple declaration of variable %s", false, false},
+    {"array-needs-braces", "array %s must be initialized with a brace-enclosed list ", false, false},
+    {"excess-initializers", "excess elements in initializer of array %s", false, false},
+    {"void-operation", "operation on void type ", false, false},
+    {"void-operand", "operation on void type : %s", false, false},
+    {"float-to-int", "Warning: Assignment of float value into variable of integer type ", true, false},
+    {"non-constant-init", "initializer element is not constant : %s", false, false},
+    {"bad-array-size", "array size is not a positive integer constant ", false, false},
+    {"nested-func-def", "Function definition must be in the global scope ", false, false},
+    {"switch-not-int", "switch quantity is not of integer type ", false, false},
+    {"break-outside", "break statement not within loop or switch ", false, false},
+    {"continue-outside", "continue statement not within a loop ", false, false},
+    {"undeclared-variable", "Undeclared variable %s", false, true},
+    {"multiple-default", "Multiple default labels in one switch ", false, false},
+    {"duplicate-case", "Duplicate case value %d", false, false},
+    {"variable-is-array", "variable is of array type : %s", false, false},
+    {"variable-is-func", "variable is of function type : %s", false, false},
+    {"not-array", "variable is not of array type : %s", false, false},
+    {"index-not-int", "array index is not of integer type : %s", false, false},
+    {"modulus-by-zero", "Modulus by 0 ", false, false},
+    {"modulus-not-int", "Modulus operator on non integer type ", false, false},
+    {"divide-by-zero", "Divide by 0 ", false, false},
+    {"undeclared-func", "Undeclared function: %s", false, true},
+    {"undefined-func", "Undefined function: %s", false, true},
+    {"arg-count", "Inconsistencies in number of arguments in function call: %s", false, false},
+    {"arg-type", "argument %d type mismatch in function call: %s", false, false},
+    {"invalid-integer", "invalid digit in integer constant %s", false, false},
+    {"integer-out-of-range", "integer constant is too large : %s", false, false},
+    {"float-out-of-range", "floating constant is out of range : %s", false, false},
+    {"array-too-large", "size of array %s is too large", false, false},
+    {"output-failed", "Couldn't write %s: %s", false, false},
+};
+
+struct diagnostic
+{
+    diag_code code;
+    int line, column; // of the start of the construct
+    long number;
+    const string* symbols[2]; // interned, NULL when unused
+};
+
+class diagnostics
+{
+private:
+    vector<diagnostic> list;
+    set<tuple<int, int, long, const string*, const string*>> seen; // exact repeats
+    set<pair<int, const string*>> seen_in_function; // once_per_function codes
+    set<tuple<int, int, long, const string*, const string*>> streamed; // written to stream_fd already
+    int errors = 0;
+    int max_errors = 0; // 0 means no limit
+    int stream_fd = -1; // JSON Lines are written here as diagnostics are reported
+
+    static void write_json_string(ostream& out, const string& text)
+    {
+        out << '"';
+        for (char c : text)
+        {
+            if (c == '"' || c == '\\') out << '\\' << c;
+            else if (c == '\n') out << "\\n";
+            else if (c == '\t') out << "\\t";
+            else if ((unsigned char)c < 0x20) out << "\\u00" << "0123456789abcdef"[c >> 4] << "0123456789abcdef"[c & 15];
+            else out << c;
+        }
+        out << '"';
+    }
+
+public:
+    void set_max_errors(int n)
+    {
+        max_errors = n;
+    }
+
+    // Stream every new diagnostic to fd as one JSON line, unbuffered so a
+    // reader sees it while the compile is still running. A reader that goes
+    // away must not kill the compiler, so SIGPIPE is ignored and EPIPE ends the stream.
+    void stream_to(int fd)
+    {
+        stream_fd = fd;
+        signal(SIGPIPE, SIG_IGN);
+    }
+
+    // Writes d to the stream unless it was written before, so a diagnostic
+    // streamed when it was found (see --jobs) is not repeated when it is reported
+    void stream(const diagnostic& d)
+    {
+        if (stream_fd < 0 || !streamed.insert(make_tuple((int)d.code, d.line, d.number, d.symbols[0], d.symbols[1])).second) return;
+        string line_text = json(d) + "\n";
+        for (size_t done = 0; done < line_text.size(); )
+        {
+            ssize_t n = write(stream_fd, line_text.data() + done, line_text.size() - done);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) { stream_fd = -1; break; } // reader went away, stop streaming
+            done += n;
+        }
+    }
+
+    // A new function body starts, cascades are counted again
+    void enter_function()
+    {
+        seen_in_function.clear();
+    }
+
+    // Records a diagnostic, returns false when it repeats one already reported
+    bool report(diag_code code, int line, int column, const string* symbol = NULL, const string* symbol2 = NULL, long number = 0)
+    {
+        if (!seen.insert(make_tuple((int)code, line, number, symbol, symbol2)).second) return false;
+        if (diag_table[code].once_per_function && !seen_in_function.insert({(int)code, symbol}).second) return false;
+
+        list.push_back({code, line, column, number, {symbol, symbol2}});
+        if (!diag_table[code].warning) errors++;
+        stream(list.back());
+        return true;
+    }
+
+    // True once -fmax-errors=N errors have been reported
+    bool limit_reached() const
+    {
+        return max_errors > 0 && errors >= max_errors;
+    }
+
+    int get_max_errors() const
+    {
+        return max_errors;
+    }
+
+    size_t size() const
+    {
+        return list.size();
+    }
+
+    string message(const diagnostic& d) const
+    {
+        string text;
+        int next = 0;
+        for (const char* p = diag_table[d.code].format; *p; p++)
+        {
+            if (p[0] == '%' && p[1] == 's')
+            {
+                const string* symbol = d.symbols[next++];
+                if (symbol) text += *symbol;
+                p++;
+            }
+            else if (p[0] == '%' && p[1] == 'd')
+            {
+                text += to_string(d.number);
+                p++;
+            }
+            else text += *p;
+        }
+        return text;
+    }
+
+    void render_text(ostream& out) const
+    {
+        for (auto& d : list)
+        {
+            if (d.line > 0) out << "At line no: " << d.line << " "; // output files have no line
+            out << message(d) << "\n\n";
+        }
+    }
+
+    // One diagnostic as a JSON object on a single line
+    string json(const diagnostic& d) const
+    {
+        ostringstream out;
+        out << "{\"severity\": \"" << (diag_table[d.code].warning ? "warning" : "error")
+            << "\", \"code\": \"" << diag_table[d.code].name << "\", \"line\": " << d.line << ", \"column\": " << d.column << ", \"symbol\": ";
+        if (d.symbols[0]) write_json_string(out, *d.symbols[0]);
+        else out << "null";
+        out << ", \"message\": ";
+        write_json_string(out, message(d));
+        out << "}";
+        return out.str();
+    }
+
+    void render_json(ostream& out) const
+    {
+        out << "[";
+        for (size_t i = 0; i < list.size(); i++)
+        {
+            out << (i ? ",\n " : "\n ") << json(list[i]);
+        }
+        out << "\n]\n";
+    }
+};
+
+#endif // DIAGNOSTICS_H
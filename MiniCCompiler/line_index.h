@@ -0,0 +1,39 @@
+#ifndef LINE_INDEX_H
+#define LINE_INDEX_H
+
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+// A position in the source is a byte offset into the scanned text, 32 bits
+// on every token and AST node. Line and column are only worked out from the
+// newline index when something is reported.
+typedef uint32_t src_offset;
+
+class line_index
+{
+private:
+    vector<src_offset> starts{0}; // offset of the first byte of each line
+
+public:
+    // The scanner passes the offset just past each newline, a rescanned
+    // lazy body passes offsets that are already known
+    void add_line(src_offset start)
+    {
+        if (start > starts.back()) starts.push_back(start);
+    }
+
+    int line(src_offset at) const
+    {
+        return upper_bound(starts.begin(), starts.end(), at) - starts.begin();
+    }
+
+    int column(src_offset at) const
+    {
+        return at - starts[line(at) - 1] + 1;
+    }
+};
+
+#endif // LINE_INDEX_H
@@ -0,0 +1,253 @@
+#ifndef OUTPUT_FILE_H
+#define OUTPUT_FILE_H
+
+#include <cerrno>
+#include <fcntl.h>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <sys/mman.h>
+#include <unistd.h>
+
+using namespace std;
+
+// Writes straight into a shared mapping of the file. Space is reserved with
+// fallocate and the mapping grows in large chunks, so there is no copy into a
+// stream buffer and no write call per flush; close truncates the file to what
+// was written. Meant for very large outputs, used by --mmap-output.
+// A file that can not be mapped or reserved (a pipe, a device, a full disk)
+// gets the rest of the output through a plain filebuf instead, whose write
+// errors are recorded like any stream's.
+class mapped_filebuf : public streambuf
+{
+private:
+    static constexpr size_t first_chunk = 1 << 20;
+    static constexpr size_t max_chunk = 256 << 20;
+
+    int fd = -1;
+    char* base = NULL;
+    size_t size = 0; // bytes mapped and reserved in the file
+    filebuf fallback;
+
+    bool reserve(size_t new_size)
+    {
+        // Only a file system that can not reserve blocks gets a sparse file. Any other
+        // failure (ENOSPC) would leave unbacked pages whose first write raises SIGBUS
+        if (fallocate(fd, 0, size, new_size - size) != 0)
+        {
+            if (errno != EOPNOTSUPP && errno != ENOSYS) return false;
+            if (ftruncate(fd, new_size) != 0) return false;
+        }
+        void* mapped = base ? mremap(base, size, new_size, MREMAP_MAYMOVE)
+                            : mmap(NULL, new_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (mapped == MAP_FAILED) return false;
+        size_t used = written();
+        base = (char*)mapped;
+        size = new_size;
+        setp(base + used, base + size); // pbump only takes an int, outputs can be larger
+        return true;
+    }
+
+    // Keeps what is already in the mapping and appends the rest through fallback
+    bool fall_back()
+    {
+        mapping_error = errno ? errno : EIO;
+        bool ok = unmap();
+        if (ok) fallback.open(path, ios::out | ios::app);
+        if (!fallback.is_open()) error = errno ? errno : EIO;
+        return fallback.is_open();
+    }
+
+    bool unmap()
+    {
+        size_t used = written();
+        if (base) munmap(base, size);
+        bool ok = ftruncate(fd, used) == 0 || used == 0; // a device can not be truncated, nothing to cut either
+        ok = ::close(fd) == 0 && ok;
+        if (!ok) error = errno ? errno : EIO;
+        fd = -1;
+        base = NULL;
+        size = 0;
+        setp(NULL, NULL);
+        return ok;
+    }
+
+protected:
+    int_type overflow(int_type c) override
+    {
+        if (!open_now()) return traits_type::eof();
+        if (fallback.is_open())
+        {
+            if (traits_type::eq_int_type(c, traits_type::eof())) return traits_type::not_eof(c);
+            return fallback.sputc(c) == traits_type::eof() ? record_failure() : c;
+        }
+        if (pptr() == epptr() && !reserve(size + min(max(size, first_chunk), max_chunk)) && !fall_back())
+            return traits_type::eof();
+        if (fallback.is_open()) return overflow(c);
+        if (!traits_type::eq_int_type(c, traits_type::eof())) sputc(c);
+        return traits_type::not_eof(c);
+    }
+
+    streamsize xsputn(const char* s, streamsize n) override
+    {
+        if (!fallback.is_open()) return streambuf::xsputn(s, n);
+        streamsize done = fallback.sputn(s, n);
+        if (done < n) record_failure();
+        return done;
+    }
+
+    int sync() override
+    {
+        if (!fallback.is_open() || fallback.pubsync() == 0) return 0;
+        record_failure();
+        return -1;
+    }
+
+    int_type record_failure()
+    {
+        if (!error) error = errno ? errno : EIO;
+        return traits_type::eof();
+    }
+
+public:
+    string path;
+    int error = 0; // errno of the first failure to open, write or close
+    int mapping_error = 0; // errno of a mapping that failed, the file was written through fallback
+
+    ~mapped_filebuf() { close(); }
+
+    bool is_open() const { return fd >= 0 || fallback.is_open(); }
+
+    size_t written() const { return base ? pptr() - base : 0; }
+
+    bool open_now()
+    {
+        if (is_open() || path == "") return is_open();
+        errno = 0;
+        fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0666);
+        if (fd < 0) error = errno;
+        else if (!reserve(first_chunk)) fall_back();
+        return is_open();
+    }
+
+    bool close()
+    {
+        if (fallback.is_open())
+        {
+            if (!fallback.close() && !error) error = errno ? errno : EIO;
+            return !error;
+        }
+        if (fd < 0) return false;
+        return unmap() && !error;
+    }
+};
+
+// An output stream whose file is only created when something is written to it,
+// or when it is closed. A run that stops before compiling anything (no input,
+// bad options) makes no open or truncate calls and leaves existing files alone.
+class output_file : public ostream
+{
+private:
+    class lazy_filebuf : public filebuf
+    {
+    public:
+        string path;
+        int error = 0; // errno of the first failure to open, write or close
+
+        bool open_now()
+        {
+            if (is_open() || path == "") return is_open();
+            errno = 0;
+            if (!open(path, ios::out | ios::trunc)) record_failure();
+            return is_open();
+        }
+
+        int_type record_failure()
+        {
+            if (!error) error = errno ? errno : EIO;
+            return traits_type::eof();
+        }
+
+    protected:
+        // An unopened filebuf has no put area, so the first write always lands here
+        int_type overflow(int_type c) override
+        {
+            if (!open_now()) return traits_type::eof();
+            int_type result = filebuf::overflow(c);
+            return traits_type::eq_int_type(result, traits_type::eof()) ? record_failure() : result;
+        }
+
+        streamsize xsputn(const char* s, streamsize n) override
+        {
+            if (!open_now()) return 0;
+            streamsize done = filebuf::xsputn(s, n);
+            if (done < n) record_failure();
+            return done;
+        }
+    };
+
+    lazy_filebuf buf;
+    mapped_filebuf mapped_buf;
+    bool mapped = false;
+    streambuf* attached = NULL;
+    int attached_error = 0;
+
+public:
+    output_file() : ostream(nullptr) { rdbuf(&buf); }
+
+    // Only remembers the path, nothing touches the file system yet.
+    // A mapped file is written through mapped_filebuf instead of a stream buffer.
+    void open(const string& path, bool use_mapping = false)
+    {
+        mapped = use_mapping;
+        if (mapped) mapped_buf.path = path;
+        else buf.path = path;
+        rdbuf(mapped ? (streambuf*)&mapped_buf : &buf);
+        clear();
+    }
+
+    // Writes to a stream that is already open, such as stdout or stderr
+    void attach(streambuf* stream)
+    {
+        attached = stream;
+        rdbuf(stream);
+        clear();
+    }
+
+    bool is_open() const { return mapped ? mapped_buf.is_open() : buf.is_open(); }
+
+    // errno of the first failure to open, write or close the file, 0 when all of it was written
+    int error() const { return attached ? attached_error : mapped ? mapped_buf.error : buf.error; }
+
+    // errno of a mapping that could not be made, the file was then written without one
+    int mapping_error() const { return mapped ? mapped_buf.mapping_error : 0; }
+
+    // Creates the file even if nothing was written, like an eager open would have
+    void close()
+    {
+        if (attached)
+        {
+            errno = 0;
+            flush();
+            if (fail()) attached_error = errno ? errno : EIO;
+            return;
+        }
+        if (mapped)
+        {
+            if (mapped_buf.path == "") return;
+            if (!mapped_buf.open_now() || !mapped_buf.close()) setstate(ios::failbit);
+            mapped_buf.path = "";
+            return;
+        }
+        if (buf.path == "") return;
+        if (!buf.open_now()) setstate(ios::failbit);
+        else if (!buf.close())
+        {
+            buf.record_failure();
+            setstate(ios::failbit);
+        }
+        buf.path = "";
+    }
+};
+
+#endif // OUTPUT_FILE_H
@@ -0,0 +1,193 @@
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <cerrno>
+#include <fstream>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+// Hardware counters per compiler phase (--perf-counters). Each event is its
+// own user-space counter on this process, inherited by threads started after
+// open(), so --jobs workers are counted once they have been joined. When the
+// kernel or the machine has no counters the phases still get wall time.
+class perf_counters
+{
+private:
+    static const int EVENTS = 4;
+
+    struct phase
+    {
+        string name;
+        int depth;
+        long ns = 0;
+        double count[EVENTS] = {};
+    };
+
+    inline static const char* names[EVENTS] = {"cycles", "instructions", "cache misses", "branch misses"};
+    inline static int fds[EVENTS] = {-1, -1, -1, -1};
+    inline static string unavailable = "not opened";
+    inline static vector<phase> phases;
+    inline static int depth = 0;
+
+#ifdef __linux__
+    static int open_event(uint64_t config)
+    {
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = config;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.inherit = 1;
+        return syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    }
+
+    static string why(int error)
+    {
+        string reason = strerror(error);
+        if (error == EACCES || error == EPERM)
+        {
+            int paranoid = 0;
+            ifstream("/proc/sys/kernel/perf_event_paranoid") >> paranoid;
+            reason += ", kernel.perf_event_paranoid is " + to_string(paranoid);
+        }
+        else if (error == ENOENT || error == EOPNOTSUPP) reason += ", no hardware counters (virtual machine?)";
+        return reason;
+    }
+#endif
+
+public:
+    struct reading
+    {
+        uint64_t value[EVENTS], enabled[EVENTS], running[EVENTS];
+        chrono::steady_clock::time_point at;
+    };
+
+    inline static bool enabled = false;
+
+    // Opens what it can, a phase shows n/a for an event that did not open
+    static void open()
+    {
+        enabled = true;
+#ifdef __linux__
+        static const uint64_t configs[EVENTS] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                                 PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+        int first_error = 0;
+        for (int i = 0; i < EVENTS; i++)
+        {
+            fds[i] = open_event(configs[i]);
+            if (fds[i] < 0 && !first_error) first_error = errno;
+        }
+        unavailable = first_error ? why(first_error) : "";
+#else
+        unavailable = "perf_event_open is Linux only";
+#endif
+    }
+
+    static bool counting(int event)
+    {
+        return fds[event] >= 0;
+    }
+
+    static void snapshot(reading& r)
+    {
+        for (int i = 0; i < EVENTS; i++)
+        {
+            uint64_t buf[3] = {0, 0, 0}; // value, time enabled, time running
+#ifdef __linux__
+            if (fds[i] >= 0 && ::read(fds[i], buf, sizeof(buf)) != sizeof(buf)) buf[0] = buf[1] = buf[2] = 0;
+#endif
+            r.value[i] = buf[0];
+            r.enabled[i] = buf[1];
+            r.running[i] = buf[2];
+        }
+        r.at = chrono::steady_clock::now();
+    }
+
+    static int begin(const string& name)
+    {
+        int index = 0;
+        while (index < (int)phases.size() && phases[index].name != name) index++;
+        if (index == (int)phases.size()) phases.push_back(phase{name, depth});
+        depth++;
+        return index;
+    }
+
+    static void end(int index, const reading& start)
+    {
+        reading stop;
+        snapshot(stop);
+        depth--;
+        phase& p = phases[index];
+        p.ns += chrono::duration_cast<chrono::nanoseconds>(stop.at - start.at).count();
+        for (int i = 0; i < EVENTS; i++)
+        {
+            // Scale up when the kernel multiplexed the counter
+            uint64_t running = stop.running[i] - start.running[i];
+            uint64_t delta = stop.value[i] - start.value[i];
+            if (running) p.count[i] += (double)delta * (stop.enabled[i] - start.enabled[i]) / running;
+        }
+    }
+
+    static void report(ostream& out)
+    {
+        out << "Hardware counters by phase";
+        if (unavailable != "") out << " (" << (counting(0) || counting(1) ? "partly " : "") << "unavailable: " << unavailable << ")";
+        out << ":" << endl;
+        out << left << setw(32) << "phase" << right << setw(10) << "wall ms";
+        for (int i = 0; i < EVENTS; i++) out << setw(15) << names[i];
+        out << setw(6) << "IPC" << endl;
+        for (const phase& p : phases)
+        {
+            out << left << setw(32) << string(2 * p.depth, ' ') + p.name << right << setw(10) << fixed
+                << setprecision(2) << p.ns / 1e6;
+            for (int i = 0; i < EVENTS; i++)
+            {
+                if (counting(i)) out << setw(15) << setprecision(0) << p.count[i];
+                else out << setw(15) << "n/a";
+            }
+            if (counting(0) && counting(1) && p.count[0] > 0) out << setw(6) << setprecision(2) << p.count[1] / p.count[0];
+            else out << setw(6) << "n/a";
+            out << endl;
+        }
+        out << left << defaultfloat << setprecision(6);
+    }
+};
+
+// Counts the enclosing block as a phase, nested phases are indented in the report
+class perf_phase
+{
+private:
+    int index = -1;
+    perf_counters::reading start;
+
+public:
+    perf_phase(const char* name)
+    {
+        if (!perf_counters::enabled) return;
+        index = perf_counters::begin(name);
+        perf_counters::snapshot(start);
+    }
+
+    ~perf_phase()
+    {
+        if (index >= 0) perf_counters::end(index, start);
+    }
+};
+
+#endif // PERF_COUNTERS_H
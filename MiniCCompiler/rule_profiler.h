@@ -0,0 +1,86 @@
+#ifndef RULE_PROFILER_H
+#define RULE_PROFILER_H
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Reductions per grammar rule and the time spent in each (--rule-profile).
+// A reduction is timed from the moment the parser starts it until the next
+// reduction starts or the parser asks the scanner for a token, so it covers
+// the rule's action and the parser's own bookkeeping, never scanning.
+class rule_profiler
+{
+private:
+    struct rule_stats
+    {
+        unsigned long count = 0;
+        long ns = 0;
+    };
+
+    vector<rule_stats> rules;
+    int open_rule = -1;
+    chrono::steady_clock::time_point open_since;
+
+    void close(chrono::steady_clock::time_point now)
+    {
+        if (open_rule < 0) return;
+        rules[open_rule].ns += chrono::duration_cast<chrono::nanoseconds>(now - open_since).count();
+        open_rule = -1;
+    }
+
+public:
+    bool enabled = false;
+
+    void reduce(int rule)
+    {
+        auto now = chrono::steady_clock::now();
+        close(now);
+        if (rule >= (int)rules.size()) rules.resize(rule + 1);
+        rules[rule].count++;
+        open_rule = rule;
+        open_since = now;
+    }
+
+    // The parser is about to scan, or is done
+    void pause()
+    {
+        if (open_rule >= 0) close(chrono::steady_clock::now());
+    }
+
+    // Rules sorted by total time, describe() names a rule by its number
+    void report(ostream& out, const function<string(int)>& describe) const
+    {
+        vector<int> order;
+        long total_ns = 0;
+        unsigned long total_count = 0;
+        for (int i = 0; i < (int)rules.size(); i++)
+        {
+            if (rules[i].count == 0) continue;
+            order.push_back(i);
+            total_ns += rules[i].ns;
+            total_count += rules[i].count;
+        }
+        sort(order.begin(), order.end(), [this](int a, int b) { return rules[a].ns > rules[b].ns; });
+
+        out << "Grammar rules by reduction cost (" << total_count << " reductions, " << total_ns / 1000 << " us):" << endl;
+        out << right << setw(5) << "rule" << setw(12) << "reductions" << setw(12) << "total us"
+            << setw(10) << "ns each" << setw(8) << "share" << "  " << "production" << endl;
+        for (int i : order)
+        {
+            const rule_stats& r = rules[i];
+            out << setw(5) << i << setw(12) << r.count << setw(12) << r.ns / 1000 << setw(10) << r.ns / (long)r.count
+                << setw(7) << fixed << setprecision(1) << (total_ns ? 100.0 * r.ns / total_ns : 0) << "%"
+                << "  " << describe(i) << endl;
+        }
+        out << defaultfloat << setprecision(6);
+    }
+};
+
+#endif // RULE_PROFILER_H
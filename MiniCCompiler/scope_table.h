@@ -1,4 +1,8 @@
+#ifndef SCOPE_TABLE_H
+#define SCOPE_TABLE_H
+
 #include "symbol_info.h"
+#include <climits>
 
 class scope_table
 {
@@ -32,10 +36,11 @@ public:
         this->ID = ID;
     }
 
-    void set_prnt(scope_table *table)
+    // A scope shared with other threads is not counted, only read
+    void set_prnt(scope_table *table, bool count_child = true)
     {
         parent_scope = table;
-        if(parent_scope!=NULL) parent_scope->incrs_chld();
+        if(parent_scope!=NULL && count_child) parent_scope->incrs_chld();
         //set_scope_table_ID();
     }
 
@@ -178,7 +183,8 @@ public:
         }
     }
 
-    void Print_scope(ofstream& outlog)
+    // Symbols declared by units after max_unit are left out
+    void Print_scope(ostream& outlog, int max_unit = INT_MAX)
     {
     	string s = "";
     	s+="ScopeTable # "+to_string(ID)+"\n";
@@ -186,7 +192,7 @@ public:
 
         for(int i = 0; i < tbl_size; i++)
         {
-            if(chains[i]!=NULL)
+            if(chains[i]!=NULL && chains[i]->getdeclunit() <= max_unit)
             {
             	s+=to_string(i)+" --> ";
             	//cout<<i<<" --> ";
@@ -195,6 +201,11 @@ public:
 
 		        while(curr_sym!=NULL)
 		        {
+                    if(curr_sym->getdeclunit() > max_unit)
+                    {
+                        curr_sym = curr_sym->get_next();
+                        continue;
+                    }
 		        	s+="\n< "+curr_sym->getname()+" : "+curr_sym->gettype()+" >\n";
                     if (curr_sym->getidtype() == "func_def")
                     {
@@ -256,4 +267,6 @@ public:
         }
         delete[] chains;
     }
-};
\ No newline at end of file
+};
+
+#endif // SCOPE_TABLE_H
@@ -0,0 +1,491 @@
+#ifndef SEMANTIC_ANALYZER_H
+#define SEMANTIC_ANALYZER_H
+
+#include "ast.h"
+#include "symbol_table.h"
+#include "diagnostics.h"
+#include <climits>
+
+using namespace std;
+
+// A diagnostic found by the analyzer, merged into the diagnostics engine in program order
+struct found_diagnostic
+{
+    diag_code code;
+    src_offset offset;
+    string symbol, symbol2;
+    long number;
+};
+
+// Semantic analysis over the AST: resolves names against the symbol table,
+// checks types and records the type of every expression node.
+//
+// Globals and function signatures are declared unit by unit into the global
+// scope first. After that a function body only reads the global scope, so each
+// body is checked by its own analyzer (own scopes, log and diagnostics) and
+// bodies can be checked in parallel.
+class semantic_analyzer
+{
+private:
+    symbol_table table; // scopes of the unit being checked, on top of the global scope
+    int unit; // globals declared by later units are not visible
+    int loop_depth = 0, switch_depth = 0; // enclosing loops and switches of the current statement
+
+    void report(diag_code code, src_offset at, string symbol = "", string symbol2 = "", long number = 0)
+    {
+        found.push_back({code, at, symbol, symbol2, number});
+    }
+
+    symbol_info* lookup(const string& name)
+    {
+        symbol_info* sym = table.Lookup_in_table(name);
+        if (sym && sym->getdeclunit() > unit) return NULL; // declared further down
+        return sym;
+    }
+
+    static bool is_relational(const string& op)
+    {
+        return op == "<" || op == ">" || op == "<=" || op == ">=" || op == "==" || op == "!=" || op == "&&" || op == "||";
+    }
+
+    string check_var(VarNode* var)
+    {
+        string type;
+        symbol_info* sym;
+
+        if (!var->has_index())
+        {
+            sym = lookup(var->get_name());
+            if (sym == NULL)
+            {
+                report(DIAG_UNDECLARED_VARIABLE, var->get_offset(), var->get_name());
+                type = "error"; //not found set error type
+            }
+            else if (sym->getidtype() != "var") //variable is not a normal variable
+            {
+                if (sym->getidtype() == "array") report(DIAG_VARIABLE_IS_ARRAY, var->get_offset(), var->get_name());
+                else if (sym->getidtype() == "func_def" || sym->getidtype() == "func_dec") report(DIAG_VARIABLE_IS_FUNC, var->get_offset(), var->get_name());
+                type = "error"; //doesnt match set error type
+            }
+            else type = sym->getvartype(); //set variable type as id type
+        }
+        else
+        {
+            string index_type = check_expr(var->get_index());
+            sym = lookup(var->get_name());
+            if (sym == NULL)
+            {
+                report(DIAG_UNDECLARED_VARIABLE, var->get_offset(), var->get_name());
+                type = "error";
+            }
+            else if (sym->getidtype() != "array") //variable is not an array
+            {
+                report(DIAG_NOT_ARRAY, var->get_offset(), var->get_name());
+                type = "error";
+            }
+            else if (index_type != "int") // array index must be an integer
+            {
+                report(DIAG_INDEX_NOT_INT, var->get_offset(), var->get_name());
+                type = "error";
+            }
+            else type = sym->getvartype();
+        }
+
+        var->set_type(type);
+        return type;
+    }
+
+    string check_binary(BinaryOpNode* node)
+    {
+        string left = check_expr(node->get_left());
+        string right = check_expr(node->get_right());
+        string op = node->get_op();
+        string type;
+
+        if (left == "void" || right == "void") //if any of them is a void
+        {
+            report(DIAG_VOID_OPERATION, node->get_offset());
+            type = "error";
+        }
+        else if (is_relational(op)) type = "int";
+        else if (left == "float" || right == "float") type = "float";
+        else type = "int";
+
+        if (op == "%" || op == "/")
+        {
+            // constant divisors are folded, so 0, 00, 0x0, 0.0 and (1-1) are all caught
+            const_value divisor;
+            bool divisor_is_zero = node->get_right()->evaluate_const(divisor) && divisor.is_zero();
+
+            if (op == "%" && left == "int" && right == "int")
+            {
+                if (divisor_is_zero)
+                {
+                    report(DIAG_MODULUS_BY_ZERO, node->get_offset());
+                    type = "error";
+                }
+            }
+            else if (op == "%" && (left == "float" || right == "float"))
+            {
+                report(DIAG_MODULUS_NOT_INT, node->get_offset());
+                type = "error";
+            }
+
+            if (op == "/" && divisor_is_zero)
+            {
+                report(DIAG_DIVIDE_BY_ZERO, node->get_offset());
+                type = "error";
+            }
+        }
+
+        if (left == "error" || right == "error") type = "error"; //if any of them is a error
+
+        node->set_type(type);
+        return type;
+    }
+
+    string check_unary(UnaryOpNode* node)
+    {
+        string operand = check_expr(node->get_expr());
+        string type = node->get_op() == "!" ? "int" : operand;
+
+        if (operand == "void")
+        {
+            report(DIAG_VOID_OPERAND, node->get_offset(), node->get_operand_text());
+            type = "error";
+        }
+
+        node->set_type(type);
+        return type;
+    }
+
+    string check_assign(AssignNode* node)
+    {
+        string lhs = check_var(node->get_lhs());
+        string rhs = check_expr(node->get_rhs());
+        string type = lhs;
+
+        if (lhs == "void" || rhs == "void") //if any of them is a void
+        {
+            report(DIAG_VOID_OPERATION, node->get_offset());
+            type = "error";
+        }
+        else if (lhs == "int" && rhs == "float") // assignment of float into int
+        {
+            report(DIAG_FLOAT_TO_INT, node->get_offset());
+            type = "int";
+        }
+
+        if (lhs == "error" || rhs == "error") type = "error";
+
+        node->set_type(type);
+        return type;
+    }
+
+    string check_call(FuncCallNode* call)
+    {
+        vector<string> arg_types;
+        for (auto arg : call->get_arguments()) arg_types.push_back(check_expr(arg));
+
+        string type = "error";
+        string name = call->get_name();
+        symbol_info* sym = lookup(name);
+
+        if (sym == NULL) report(DIAG_UNDECLARED_FUNC, call->get_offset(), name);
+        else if (sym->getidtype() == "func_dec") report(DIAG_UNDEFINED_FUNC, call->get_offset(), name); //declared but not defined
+        else if (sym->getidtype() == "func_def")
+        {
+            vector<string> params = sym->getparamlist();
+            bool mismatch = false;
+
+            if (arg_types.size() != params.size()) //number of parameters don't match
+            {
+                report(DIAG_ARG_COUNT, call->get_offset(), name);
+            }
+            else
+            {
+                for (size_t i = 0; i < params.size(); i++)
+                {
+                    if (arg_types[i] == params[i] || arg_types[i] == "error") continue;
+                    if (arg_types[i] == "int" && params[i] == "float") continue;
+                    mismatch = true;
+                    report(DIAG_ARG_TYPE, call->get_offset(), name, "", i + 1);
+                }
+            }
+            if (!mismatch) type = sym->getvartype();
+        }
+
+        call->set_type(type);
+        return type;
+    }
+
+    void check_declaration(DeclNode* decl)
+    {
+        // sizes and initial values are expressions of their own, checked first
+        for (size_t i = 0; i < decl->get_vars().size(); i++)
+        {
+            if (ExprNode* size_expr = decl->get_size_expr(i))
+            {
+                string size_type = check_expr(size_expr);
+                const_value size;
+                if (size_type == "int" && size_expr->evaluate_const(size) && size.integer > 0)
+                {
+                    // sizes are ints from here on
+                    if (size.integer <= INT_MAX) decl->set_array_size(i, (int)size.integer);
+                    else report(DIAG_ARRAY_TOO_LARGE, size_expr->get_offset(), decl->get_vars()[i].first);
+                }
+                else if (size_type != "error") report(DIAG_BAD_ARRAY_SIZE, size_expr->get_offset());
+            }
+            for (auto value : decl->get_inits(i)) check_expr(value);
+        }
+
+        string type = decl->get_type();
+        if (type == "void")
+        {
+            report(DIAG_VOID_VARIABLE, decl->get_offset());
+            type = "error"; //variable is declared void so pass error instead
+            decl->set_type(type);
+        }
+
+        for (size_t i = 0; i < decl->get_vars().size(); i++)
+        {
+            const string& name = decl->get_vars()[i].first;
+            int array_size = decl->get_vars()[i].second;
+            const vector<ExprNode*>& values = decl->get_inits(i);
+
+            if (array_size == 0) // normal variable
+            {
+                if (decl->is_braced(i)) report(DIAG_SCALAR_BRACES, decl->get_offset(), name);
+            }
+            else if (!values.empty() && !decl->is_braced(i)) report(DIAG_ARRAY_NEEDS_BRACES, decl->get_offset(), name);
+            else if (values.size() > array_size) report(DIAG_EXCESS_INITIALIZERS, decl->get_offset(), name);
+
+            if (table.Insert_in_table(name, "ID"))
+            {
+                symbol_info* sym = table.Lookup_in_table(name);
+                sym->setvartype(type);
+                sym->setidtype(array_size == 0 ? "var" : "array");
+                if (array_size) sym->setarraysize(array_size);
+                sym->setdeclunit(decl->is_global() ? unit : 0);
+            }
+            else report(DIAG_MULTIPLE_VAR_DECL, decl->get_offset(), name);
+
+            // type check the initial values
+            for (auto value : values)
+            {
+                const_value folded;
+                if (value->get_type() == "void") report(DIAG_VOID_OPERATION, decl->get_offset());
+                else if (type == "int" && value->get_type() == "float") report(DIAG_FLOAT_TO_INT, decl->get_offset());
+                else if (decl->is_global() && value->get_type() != "error" && !value->evaluate_const(folded))
+                {
+                    report(DIAG_NON_CONSTANT_INIT, decl->get_offset(), name);
+                }
+            }
+        }
+    }
+
+    // A compound statement, a function body also declares the parameters in its scope
+    void check_block(BlockNode* block, const vector<pair<string, string>>* params = NULL)
+    {
+        if (block->opens_scope()) table.enter_scope(log);
+
+        if (params)
+        {
+            for (auto& param : *params)
+            {
+                if (param.second == "_null_") continue;
+                if (table.Insert_in_table(param.second, "ID"))
+                {
+                    table.Lookup_in_table(param.second)->setidtype("var");
+                    table.Lookup_in_table(param.second)->setvartype(param.first);
+                }
+            }
+        }
+
+        for (auto stmt : block->get_statements()) check_stmt(stmt);
+
+        if (block->opens_scope())
+        {
+            table.Print_all_scope(log, unit);
+            table.exit_scope(log);
+        }
+    }
+
+    void check_switch(SwitchNode* node)
+    {
+        string type = check_expr(node->get_condition());
+
+        table.enter_scope(log);
+        switch_depth++;
+
+        set<int64_t> values;
+        bool has_default = false;
+        for (auto c : node->get_cases())
+        {
+            if (c->get_body()) check_stmt(c->get_body());
+
+            if (c->get_is_default())
+            {
+                if (has_default) report(DIAG_MULTIPLE_DEFAULT, c->get_offset());
+                has_default = true;
+            }
+            else if (!values.insert(c->get_value()).second) report(DIAG_DUPLICATE_CASE, c->get_offset(), "", "", c->get_value());
+        }
+
+        switch_depth--;
+        if (type != "int" && type != "error") report(DIAG_SWITCH_NOT_INT, node->get_offset());
+
+        table.Print_all_scope(log, unit);
+        table.exit_scope(log);
+    }
+
+public:
+    ostringstream log; // scope dumps, appended to log.txt in program order
+    vector<found_diagnostic> found;
+
+    // Scopes are numbered from first_scope_ID, the caller reserves scopes_opened of them
+    semantic_analyzer(scope_table* global_scope, int unit_index, int first_scope_ID)
+        : table(global_scope, first_scope_ID), unit(unit_index) {}
+
+    // Scopes that checking stmt opens, following check_stmt. Reserving IDs up
+    // front keeps the numbering the same whichever thread checks a body first.
+    static int scopes_opened(StmtNode* stmt)
+    {
+        int n = 0;
+        if (auto s = dynamic_cast<BlockNode*>(stmt))
+        {
+            n = s->opens_scope();
+            for (auto inner : s->get_statements()) n += scopes_opened(inner);
+        }
+        else if (auto s = dynamic_cast<IfNode*>(stmt)) n = scopes_opened(s->get_then()) + scopes_opened(s->get_else());
+        else if (auto s = dynamic_cast<WhileNode*>(stmt)) n = scopes_opened(s->get_body());
+        else if (auto s = dynamic_cast<DoWhileNode*>(stmt)) n = scopes_opened(s->get_body());
+        else if (auto s = dynamic_cast<ForNode*>(stmt))
+        {
+            n = scopes_opened(dynamic_cast<StmtNode*>(s->get_init())) + scopes_opened(dynamic_cast<StmtNode*>(s->get_condition()));
+            n += scopes_opened(s->get_body());
+        }
+        else if (auto s = dynamic_cast<SwitchNode*>(stmt))
+        {
+            n = 1;
+            for (auto c : s->get_cases()) n += scopes_opened(c->get_body());
+        }
+        return n;
+    }
+
+    static int scopes_opened(FuncDeclNode* func)
+    {
+        return func ? scopes_opened(func->get_body()) : 0;
+    }
+
+    string check_expr(ExprNode* expr)
+    {
+        if (auto var = dynamic_cast<VarNode*>(expr)) return check_var(var);
+        if (auto binary = dynamic_cast<BinaryOpNode*>(expr)) return check_binary(binary);
+        if (auto unary = dynamic_cast<UnaryOpNode*>(expr)) return check_unary(unary);
+        if (auto assign = dynamic_cast<AssignNode*>(expr)) return check_assign(assign);
+        if (auto call = dynamic_cast<FuncCallNode*>(expr)) return check_call(call);
+        return expr->get_type(); // constants are typed by the parser
+    }
+
+    void check_stmt(StmtNode* stmt)
+    {
+        if (auto s = dynamic_cast<ExprStmtNode*>(stmt)) { if (s->get_expr()) check_expr(s->get_expr()); }
+        else if (auto s = dynamic_cast<BlockNode*>(stmt)) check_block(s);
+        else if (auto s = dynamic_cast<DeclNode*>(stmt)) check_declaration(s);
+        else if (auto s = dynamic_cast<IfNode*>(stmt))
+        {
+            check_expr(s->get_condition());
+            check_stmt(s->get_then());
+            if (s->get_else()) check_stmt(s->get_else());
+        }
+        else if (auto s = dynamic_cast<WhileNode*>(stmt))
+        {
+            check_expr(s->get_condition());
+            loop_depth++;
+            check_stmt(s->get_body());
+            loop_depth--;
+        }
+        else if (auto s = dynamic_cast<DoWhileNode*>(stmt))
+        {
+            loop_depth++;
+            check_stmt(s->get_body());
+            loop_depth--;
+            check_expr(s->get_condition());
+        }
+        else if (auto s = dynamic_cast<ForNode*>(stmt))
+        {
+            if (auto init = dynamic_cast<StmtNode*>(s->get_init())) check_stmt(init);
+            if (auto cond = dynamic_cast<StmtNode*>(s->get_condition())) check_stmt(cond);
+            if (s->get_update()) check_expr(s->get_update());
+            loop_depth++;
+            check_stmt(s->get_body());
+            loop_depth--;
+        }
+        else if (auto s = dynamic_cast<SwitchNode*>(stmt)) check_switch(s);
+        else if (dynamic_cast<BreakNode*>(stmt))
+        {
+            if (loop_depth == 0 && switch_depth == 0) report(DIAG_BREAK_OUTSIDE, stmt->get_offset());
+        }
+        else if (dynamic_cast<ContinueNode*>(stmt))
+        {
+            if (loop_depth == 0) report(DIAG_CONTINUE_OUTSIDE, stmt->get_offset());
+        }
+        else if (auto s = dynamic_cast<ReturnNode*>(stmt)) { if (s->get_expr()) check_expr(s->get_expr()); }
+    }
+
+    // Declares a global variable or a function signature in the global scope
+    void declare_unit(ASTNode* node)
+    {
+        if (auto decl = dynamic_cast<DeclNode*>(node))
+        {
+            check_declaration(decl);
+            return;
+        }
+
+        FuncDeclNode* func = dynamic_cast<FuncDeclNode*>(node);
+        if (func == NULL) return;
+
+        string name = func->get_name();
+        vector<string> types, names;
+        for (auto& param : func->get_params())
+        {
+            if (param.second != "_null_" && count(names.begin(), names.end(), param.second))
+            {
+                report(DIAG_MULTIPLE_PARAM_DECL, func->get_offset(), param.second, name);
+            }
+            types.push_back(param.first);
+            names.push_back(param.second);
+        }
+
+        for (size_t i = 0; i < names.size(); i++) //check parameters
+        {
+            if (names[i] == "_null_") report(DIAG_PARAM_NAME_MISSING, func->get_offset(), name, "", i + 1);
+        }
+
+        //check if function already present and do error checking
+        if (table.Insert_in_table(name, "ID"))
+        {
+            symbol_info* sym = table.Lookup_in_table(name);
+            sym->setvartype(func->get_return_type());
+            sym->setidtype("func_def");
+            sym->setparamlist(types); //initialize parameters
+            sym->setparamname(names);
+            sym->setdeclunit(unit);
+        }
+        else report(DIAG_MULTIPLE_FUNC_DECL, func->get_offset(), name);
+
+        if (table.Lookup_in_table(name)->getvartype() != func->get_return_type())
+        {
+            report(DIAG_RETURN_TYPE_MISMATCH, func->get_offset(), name);
+        }
+    }
+
+    // Checks a function body against the global scope, read only
+    void check_function(FuncDeclNode* func)
+    {
+        if (func->get_body()) check_block(func->get_body(), &func->get_params());
+    }
+};
+
+#endif // SEMANTIC_ANALYZER_H
@@ -0,0 +1,32 @@
+#ifndef SEMANTIC_VALUES_H
+#define SEMANTIC_VALUES_H
+
+#include <string>
+#include <cstdint>
+#include <unordered_set>
+#include "line_index.h"
+
+using namespace std;
+
+// Shared by the scanner and the parser, must be included before y.tab.h
+
+class ASTNode;
+class ExprNode;
+
+// Identifiers, operators and type names are interned once, grammar values carry the pointer
+inline const string* intern(const string& text)
+{
+    static unordered_set<string> pool;
+    return &*pool.insert(text).first;
+}
+
+// Location of a grammar symbol: byte offsets into the scanned text
+struct src_span
+{
+    src_offset begin, end;
+};
+
+#define YYLTYPE src_span
+#define YYLTYPE_IS_DECLARED 1
+
+#endif // SEMANTIC_VALUES_H
@@ -15,6 +15,7 @@ private:
     string ID_type; //var, array, func_dec, func_def
     string var_type; //int, float, void, error
     int array_size;
+    int decl_unit = 0; //program unit that declared a global, later units can't see it
     vector<string> param_list;//for functions
     vector<string> param_name;
     symbol_info *next_sym;
@@ -99,6 +100,16 @@ public:
     	param_name = list;
     }
     
+    int getdeclunit()
+    {
+        return decl_unit;
+    }
+    
+    void setdeclunit(int unit)
+    {
+        decl_unit = unit;
+    }
+    
     int getparamsize()
     {
     	return param_list.size();
@@ -124,4 +135,4 @@ public:
     }
 };
 
-#endif // SYMBOL_INFO_H
\ No newline at end of file
+#endif // SYMBOL_INFO_H
\ No newline at end of file
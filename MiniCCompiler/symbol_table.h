@@ -1,12 +1,29 @@
+#ifndef SYMBOL_TABLE_H
+#define SYMBOL_TABLE_H
+
 #include "scope_table.h"
+#include "alloc_tracker.h"
+#include "trace.h"
 
 class symbol_table
 {
 private:
     scope_table *curr_scope = NULL;
+    scope_table *base_scope = NULL; // shared outer scope, owned by another table
     int scope_size = 10;
-    int ID = 0;
+    int next_ID; // IDs are handed out to tables in blocks, see semantic_analyzer::scopes_opened
 public:
+    symbol_table(scope_table *outer = NULL, int first_ID = 1)
+    {
+        curr_scope = base_scope = outer;
+        next_ID = first_ID;
+    }
+
+    scope_table* get_curr_scope()
+    {
+        return curr_scope;
+    }
+
 	int getID()
 	{
 		return curr_scope->getID();
@@ -15,19 +32,21 @@ public:
     {
         scope_size = n;
     }
-    void enter_scope(ofstream& outlog)
+    void enter_scope(ostream& outlog)
     {
-        ID+=1;
-        scope_table *new_scope = new scope_table(scope_size, ID);
-        new_scope->set_prnt(curr_scope);
+        alloc_scope scope(ALLOC_SYMBOLS);
+        scope_table *new_scope = new scope_table(scope_size, next_ID++);
+        new_scope->set_prnt(curr_scope, curr_scope != base_scope);
         curr_scope = new_scope;
         outlog<<"New ScopeTable with ID "<<curr_scope->getID()<<" created"<<endl<<endl;
+        if(tracer::enabled) tracer::begin("scope " + to_string(curr_scope->getID()), "scope");
         //if(new_scope->getID() != "1")cout<<curr_scope->getID()<<" "<<(curr_scope->get_prnt())->getID()<<endl;
     }
 
-    void exit_scope(ofstream& outlog)
+    void exit_scope(ostream& outlog)
     {
     	outlog<<"Scopetable with ID "<<curr_scope->getID()<<" removed"<<endl<<endl;
+        if(tracer::enabled) tracer::end("scope " + to_string(curr_scope->getID()), "scope");
         scope_table *buffer = curr_scope;
         curr_scope = curr_scope->get_prnt();
         delete buffer;
@@ -37,6 +56,7 @@ public:
 
     bool Insert_in_table(string name, string type)
     {
+        alloc_scope scope(ALLOC_SYMBOLS);
         if(curr_scope->Insert_in_scope(name,type)) return true;
         else return false;
     }
@@ -69,14 +89,14 @@ public:
         //curr_scope->Print_scope();
     }
 
-    void Print_all_scope(ofstream& outlog)
+    void Print_all_scope(ostream& outlog, int max_unit = INT_MAX)
     {
         outlog<<"################################"<<endl<<endl;
         scope_table *buffer = curr_scope;
 
         while(buffer!=NULL)
         {
-            buffer->Print_scope(outlog);
+            buffer->Print_scope(outlog, max_unit);
             buffer = buffer->get_prnt();
         }
         outlog<<"################################"<<endl<<endl;
@@ -84,7 +104,14 @@ public:
 
     ~symbol_table()
     {
-        delete curr_scope;
+        while(curr_scope != base_scope)
+        {
+            scope_table *buffer = curr_scope;
+            curr_scope = curr_scope->get_prnt();
+            delete buffer;
+        }
     }
 
 };
+
+#endif // SYMBOL_TABLE_H
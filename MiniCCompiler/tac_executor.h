@@ -0,0 +1,495 @@
+#ifndef TAC_EXECUTOR_H
+#define TAC_EXECUTOR_H
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+// Runs emitted three-address code (--run), so two builds of one program can
+// be compared by behaviour instead of by text. Ints are 64 bits and wrap.
+// Locals come into being at their "// Declaration:" comment, parameters are
+// bound by position from the preceding param instructions.
+class tac_executor
+{
+public:
+    struct value
+    {
+        bool is_float = false;
+        int64_t i = 0;
+        double f = 0;
+
+        double as_float() const { return is_float ? f : (double)i; }
+        int64_t as_int() const { return is_float ? (int64_t)f : i; }
+        bool truthy() const { return is_float ? f != 0 : i != 0; }
+    };
+
+private:
+    enum op_kind
+    {
+        OP_DECL, OP_MOVE, OP_LOAD_ELEM, OP_STORE, OP_STORE_ELEM, OP_BINARY, OP_UNARY,
+        OP_PARAM, OP_CALL, OP_GOTO, OP_IF, OP_IF_FALSE, OP_JUMP_TABLE, OP_RETURN
+    };
+
+    struct instr
+    {
+        op_kind kind;
+        string dst, a, b, op; // a[b] for element access, the callee for calls
+        vector<string> targets;
+        int count = 0; // array size of a declaration, argument count of a call
+    };
+
+    struct function
+    {
+        string return_type;
+        vector<pair<string, string>> params; // type, name
+        vector<instr> code;
+        map<string, int> labels;
+    };
+
+    struct variable
+    {
+        string type;
+        vector<value> elems; // one for a scalar
+    };
+
+    struct frame
+    {
+        unordered_map<string, variable> locals;
+        unordered_map<string, value> temps;
+    };
+
+    map<string, function> functions;
+    map<string, variable> globals;
+    vector<value> params; // pending arguments
+    int depth = 0;
+
+    static bool is_temp(const string& s)
+    {
+        return s.size() > 1 && s[0] == 't' && all_of(s.begin() + 1, s.end(), ::isdigit);
+    }
+
+    static bool is_number(const string& s)
+    {
+        size_t digit = s.size() > 1 && s[0] == '-';
+        return digit < s.size() && (isdigit((unsigned char)s[digit]) || s[digit] == '.');
+    }
+
+    static value number(const string& s)
+    {
+        value v;
+        if (s.find_first_of(".eEn") != string::npos)
+        {
+            v.is_float = true;
+            v.f = stod(s);
+        }
+        else v.i = stoll(s);
+        return v;
+    }
+
+    static value convert(const value& v, const string& type)
+    {
+        value out;
+        if (type == "float")
+        {
+            out.is_float = true;
+            out.f = v.as_float();
+        }
+        else out.i = v.as_int();
+        return out;
+    }
+
+    // "name" or "name[size]" after a type
+    static void declared(const string& text, string& name, int& size)
+    {
+        size_t open = text.find('[');
+        name = text.substr(0, open);
+        size = open == string::npos ? 0 : stoi(text.substr(open + 1));
+    }
+
+    static void split_element(string text, string& name, string& index)
+    {
+        size_t open = text.find('[');
+        name = text.substr(0, open);
+        index = text.substr(open + 1, text.size() - open - 2);
+    }
+
+    [[noreturn]] static void fail(const string& why)
+    {
+        throw runtime_error(why);
+    }
+
+    variable& lookup(frame& f, const string& name)
+    {
+        auto local = f.locals.find(name);
+        if (local != f.locals.end()) return local->second;
+        auto global = globals.find(name);
+        if (global != globals.end()) return global->second;
+        fail("use of unknown variable " + name);
+    }
+
+    value operand(frame& f, const string& s)
+    {
+        if (is_temp(s))
+        {
+            auto t = f.temps.find(s);
+            if (t == f.temps.end()) fail("use of unset temp " + s);
+            return t->second;
+        }
+        if (is_number(s)) return number(s);
+        return lookup(f, s).elems[0];
+    }
+
+    value& element(frame& f, const string& name, const string& index)
+    {
+        variable& var = lookup(f, name);
+        int64_t at = operand(f, index).as_int();
+        if (at < 0 || at >= (int64_t)var.elems.size()) fail("index " + to_string(at) + " out of bounds of " + name);
+        return var.elems[at];
+    }
+
+    static value binary(const string& op, const value& l, const value& r)
+    {
+        value v;
+        if (op == "&&") v.i = l.truthy() && r.truthy();
+        else if (op == "||") v.i = l.truthy() || r.truthy();
+        else if (l.is_float || r.is_float)
+        {
+            double x = l.as_float(), y = r.as_float();
+            if (op == "<") v.i = x < y;
+            else if (op == ">") v.i = x > y;
+            else if (op == "<=") v.i = x <= y;
+            else if (op == ">=") v.i = x >= y;
+            else if (op == "==") v.i = x == y;
+            else if (op == "!=") v.i = x != y;
+            else
+            {
+                v.is_float = true;
+                if (op == "+") v.f = x + y;
+                else if (op == "-") v.f = x - y;
+                else if (op == "*") v.f = x * y;
+                else if (op == "/") v.f = x / y;
+                else fail("operator " + op + " on float");
+            }
+        }
+        else
+        {
+            uint64_t x = l.i, y = r.i; // wrap instead of overflowing
+            if (op == "+") v.i = x + y;
+            else if (op == "-") v.i = x - y;
+            else if (op == "*") v.i = x * y;
+            else if (op == "/" || op == "%")
+            {
+                if (r.i == 0) fail("division by zero");
+                if (l.i == INT64_MIN && r.i == -1) v.i = op == "/" ? INT64_MIN : 0;
+                else v.i = op == "/" ? l.i / r.i : l.i % r.i;
+            }
+            else if (op == "<") v.i = l.i < r.i;
+            else if (op == ">") v.i = l.i > r.i;
+            else if (op == "<=") v.i = l.i <= r.i;
+            else if (op == ">=") v.i = l.i >= r.i;
+            else if (op == "==") v.i = l.i == r.i;
+            else if (op == "!=") v.i = l.i != r.i;
+            else fail("unknown operator " + op);
+        }
+        return v;
+    }
+
+    instr decode(const string& line)
+    {
+        instr in;
+        istringstream words(line);
+        string first, second, word;
+        words >> first >> second;
+
+        if (first == "goto")
+        {
+            in.kind = OP_GOTO;
+            in.targets.push_back(second);
+        }
+        else if (first == "if" || first == "ifFalse")
+        {
+            in.kind = first == "if" ? OP_IF : OP_IF_FALSE;
+            in.a = second;
+            words >> word >> word;
+            in.targets.push_back(word);
+        }
+        else if (first == "jump_table")
+        {
+            in.kind = OP_JUMP_TABLE;
+            in.a = second;
+            words >> word; // ':'
+            while (words >> word)
+            {
+                if (word.back() == ',') word.pop_back();
+                in.targets.push_back(word);
+            }
+        }
+        else if (first == "return")
+        {
+            in.kind = OP_RETURN;
+            in.a = second;
+        }
+        else if (first == "param")
+        {
+            in.kind = OP_PARAM;
+            in.a = second;
+        }
+        else if (first == "call")
+        {
+            in.kind = OP_CALL;
+            in.a = second.substr(0, second.size() - 1);
+            words >> in.count;
+        }
+        else
+        {
+            size_t eq = line.find(" = ");
+            if (eq == string::npos) fail("can not run \"" + line + "\"");
+            in.dst = line.substr(0, eq);
+            vector<string> rhs;
+            istringstream rest(line.substr(eq + 3));
+            while (rest >> word) rhs.push_back(word);
+
+            if (!is_temp(in.dst))
+            {
+                in.a = rhs[0];
+                if (in.dst.find('[') != string::npos)
+                {
+                    in.kind = OP_STORE_ELEM;
+                    split_element(in.dst, in.dst, in.b);
+                }
+                else in.kind = OP_STORE;
+            }
+            else if (rhs[0] == "call")
+            {
+                in.kind = OP_CALL;
+                in.a = rhs[1].substr(0, rhs[1].size() - 1);
+                in.count = stoi(rhs[2]);
+            }
+            else if (rhs.size() == 3)
+            {
+                in.kind = OP_BINARY;
+                in.a = rhs[0];
+                in.op = rhs[1];
+                in.b = rhs[2];
+            }
+            else if ((rhs[0][0] == '-' || rhs[0][0] == '!') && is_temp(rhs[0].substr(1)))
+            {
+                in.kind = OP_UNARY;
+                in.op = rhs[0].substr(0, 1);
+                in.a = rhs[0].substr(1);
+            }
+            else if (rhs[0].find('[') != string::npos)
+            {
+                in.kind = OP_LOAD_ELEM;
+                split_element(rhs[0], in.a, in.b);
+            }
+            else
+            {
+                in.kind = OP_MOVE;
+                in.a = rhs[0];
+            }
+        }
+        return in;
+    }
+
+    value call(const string& name, vector<value> args)
+    {
+        auto it = functions.find(name);
+        if (it == functions.end()) fail("call to unknown function " + name);
+        const function& fn = it->second;
+        if (++depth > 10000) fail("call depth over 10000");
+
+        frame f;
+        for (size_t i = 0; i < fn.params.size() && i < args.size(); i++)
+        {
+            f.locals[fn.params[i].second] = variable{fn.params[i].first, {convert(args[i], fn.params[i].first)}};
+        }
+
+        value result;
+        size_t pc = 0;
+        while (pc < fn.code.size())
+        {
+            const instr& in = fn.code[pc++];
+            if (++executed > step_limit) fail("step limit of " + to_string(step_limit) + " instructions reached");
+            switch (in.kind)
+            {
+            case OP_DECL:
+                if (!f.locals.count(in.dst)) f.locals[in.dst] = variable{in.op, vector<value>(max(in.count, 1), convert(value(), in.op))};
+                break;
+            case OP_MOVE:
+                f.temps[in.dst] = operand(f, in.a);
+                break;
+            case OP_LOAD_ELEM:
+                f.temps[in.dst] = element(f, in.a, in.b);
+                break;
+            case OP_STORE:
+            {
+                variable& var = lookup(f, in.dst);
+                var.elems[0] = convert(operand(f, in.a), var.type);
+                break;
+            }
+            case OP_STORE_ELEM:
+                element(f, in.dst, in.b) = convert(operand(f, in.a), lookup(f, in.dst).type);
+                break;
+            case OP_BINARY:
+                f.temps[in.dst] = binary(in.op, operand(f, in.a), operand(f, in.b));
+                break;
+            case OP_UNARY:
+            {
+                value v = operand(f, in.a);
+                if (in.op == "!")
+                {
+                    v.i = !v.truthy();
+                    v.is_float = false;
+                }
+                else if (v.is_float) v.f = -v.f;
+                else v.i = (int64_t)(0 - (uint64_t)v.i);
+                f.temps[in.dst] = v;
+                break;
+            }
+            case OP_PARAM:
+                params.push_back(operand(f, in.a));
+                break;
+            case OP_CALL:
+            {
+                if ((int)params.size() < in.count) fail("call to " + in.a + " without its arguments");
+                vector<value> passed(params.end() - in.count, params.end());
+                params.resize(params.size() - in.count);
+                value v = call(in.a, passed);
+                if (in.dst != "") f.temps[in.dst] = v;
+                break;
+            }
+            case OP_GOTO:
+                pc = fn.labels.at(in.targets[0]);
+                break;
+            case OP_IF:
+            case OP_IF_FALSE:
+                if (operand(f, in.a).truthy() == (in.kind == OP_IF)) pc = fn.labels.at(in.targets[0]);
+                break;
+            case OP_JUMP_TABLE:
+            {
+                int64_t at = operand(f, in.a).as_int();
+                if (at < 0 || at >= (int64_t)in.targets.size()) fail("jump_table index out of range");
+                pc = fn.labels.at(in.targets[at]);
+                break;
+            }
+            case OP_RETURN:
+                if (in.a != "") result = convert(operand(f, in.a), fn.return_type);
+                depth--;
+                return result;
+            }
+        }
+        depth--;
+        return convert(result, fn.return_type); // fell off the end
+    }
+
+    static void print_value(ostream& out, const value& v)
+    {
+        if (v.is_float) out << v.f;
+        else out << v.i;
+    }
+
+public:
+    unsigned long executed = 0;
+    unsigned long step_limit = 100000000;
+
+    // Reads a code.txt, throws runtime_error on code it does not understand
+    void load(istream& tac)
+    {
+        string line;
+        function* current = NULL;
+        while (getline(tac, line))
+        {
+            if (line == "") continue;
+            if (line.rfind("// Function: ", 0) == 0)
+            {
+                // "// Function: int add(int a, int b)"
+                size_t open = line.find('('), space = line.rfind(' ', open);
+                string name = line.substr(space + 1, open - space - 1);
+                current = &functions[name];
+                current->return_type = line.substr(13, space - 13);
+                istringstream list(line.substr(open + 1, line.size() - open - 2));
+                string type, param;
+                while (list >> type >> param)
+                {
+                    if (param.back() == ',') param.pop_back();
+                    current->params.push_back({type, param});
+                }
+                continue;
+            }
+            if (line.rfind("// Declaration: ", 0) == 0)
+            {
+                istringstream words(line.substr(16));
+                string type, text, name;
+                int size;
+                words >> type >> text;
+                declared(text, name, size);
+                if (current)
+                {
+                    instr in;
+                    in.kind = OP_DECL;
+                    in.op = type;
+                    in.dst = name;
+                    in.count = size;
+                    current->code.push_back(in);
+                }
+                else if (!globals.count(name)) globals[name] = variable{type, vector<value>(max(size, 1), convert(value(), type))};
+                continue;
+            }
+            if (line.rfind("//", 0) == 0) continue;
+            if (line.rfind("data ", 0) == 0)
+            {
+                // "data int tbl[8] = 1, 2, 3" or "data float pi = 3.25"
+                istringstream words(line.substr(5));
+                string type, text, name, word;
+                int size;
+                words >> type >> text >> word;
+                declared(text, name, size);
+                variable var{type, vector<value>(max(size, 1), convert(value(), type))};
+                for (size_t i = 0; words >> word && i < var.elems.size(); i++)
+                {
+                    if (word.back() == ',') word.pop_back();
+                    var.elems[i] = convert(number(word), type);
+                }
+                globals[name] = var;
+                continue;
+            }
+            if (!current) fail("code outside a function: " + line);
+            if (line.back() == ':' && line.find(' ') == string::npos)
+            {
+                current->labels[line.substr(0, line.size() - 1)] = current->code.size();
+                continue;
+            }
+            current->code.push_back(decode(line));
+        }
+    }
+
+    // Runs main and writes what it returned and the final globals, sorted by name
+    void run(ostream& out)
+    {
+        value result = call("main", {});
+        out << "Program returned ";
+        print_value(out, result);
+        out << endl;
+        for (auto& g : globals)
+        {
+            out << g.first << " =";
+            for (size_t i = 0; i < g.second.elems.size(); i++)
+            {
+                out << (i ? ", " : " ");
+                print_value(out, g.second.elems[i]);
+            }
+            out << endl;
+        }
+    }
+};
+
+#endif // TAC_EXECUTOR_H
@@ -0,0 +1,361 @@
+#ifndef TAC_METRICS_H
+#define TAC_METRICS_H
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Quality metrics of emitted three-address code (--tac-metrics), per function
+// and in total. It reads the TAC text back, so it judges exactly what the
+// generator wrote, and can compare against the metrics of an earlier run.
+class tac_metrics
+{
+public:
+    struct function_metrics
+    {
+        map<string, long> opcodes; // copy, const, load, store, call, goto, if, +, <, ...
+        long instructions = 0, temps = 0, labels = 0, jumps = 0, loads = 0, stores = 0, calls = 0, max_live = 0;
+    };
+
+private:
+    // One instruction, reduced to what liveness and the counters need
+    struct instr
+    {
+        string opcode;
+        int def = -1;      // temp written, if any
+        vector<int> uses;  // temps read
+        vector<string> targets;
+        bool falls_through = true;
+    };
+
+    vector<pair<string, function_metrics>> functions; // in output order
+    function_metrics total;
+
+    static bool is_temp(const string& token)
+    {
+        if (token.size() < 2 || token[0] != 't') return false;
+        for (size_t i = 1; i < token.size(); i++)
+            if (!isdigit((unsigned char)token[i])) return false;
+        return true;
+    }
+
+    static bool is_number(const string& token)
+    {
+        return token != "" && (isdigit((unsigned char)token[0]) || (token.size() > 1 && token[0] == '-' && isdigit((unsigned char)token[1])));
+    }
+
+    // Every temp named in text, including array indexes
+    static void temps_in(const string& text, map<string, int>& ids, vector<int>& out)
+    {
+        size_t i = 0;
+        while (i < text.size())
+        {
+            if (isalpha((unsigned char)text[i]) || text[i] == '_')
+            {
+                size_t j = i;
+                while (j < text.size() && (isalnum((unsigned char)text[j]) || text[j] == '_')) j++;
+                string token = text.substr(i, j - i);
+                if (is_temp(token)) out.push_back(ids.emplace(token, ids.size()).first->second);
+                i = j;
+            }
+            else i++;
+        }
+    }
+
+    static instr decode(const string& line, map<string, int>& ids)
+    {
+        instr in;
+        istringstream words(line);
+        string first, second;
+        words >> first >> second;
+
+        if (first == "goto")
+        {
+            in.opcode = "goto";
+            in.targets.push_back(second);
+            in.falls_through = false;
+        }
+        else if (first == "if" || first == "ifFalse")
+        {
+            string go, label;
+            words >> go >> label;
+            in.opcode = first;
+            in.targets.push_back(label);
+            temps_in(second, ids, in.uses);
+        }
+        else if (first == "jump_table")
+        {
+            in.opcode = first;
+            temps_in(second, ids, in.uses);
+            string label;
+            words >> label; // the ':'
+            while (words >> label)
+            {
+                if (label.back() == ',') label.pop_back();
+                in.targets.push_back(label);
+            }
+            in.falls_through = false;
+        }
+        else if (first == "return")
+        {
+            in.opcode = first;
+            temps_in(second, ids, in.uses);
+            in.falls_through = false;
+        }
+        else if (first == "param" || first == "call")
+        {
+            in.opcode = first;
+            if (first == "param") temps_in(second, ids, in.uses);
+        }
+        else
+        {
+            // dst = rhs, where rhs is a value, a op b, an operator glued to a value, or a call
+            size_t eq = line.find(" = ");
+            string dst = line.substr(0, eq), rhs = eq == string::npos ? "" : line.substr(eq + 3);
+            vector<string> parts;
+            istringstream rhs_words(rhs);
+            for (string w; rhs_words >> w;) parts.push_back(w);
+
+            temps_in(rhs, ids, in.uses);
+            if (is_temp(dst)) in.def = ids.emplace(dst, ids.size()).first->second;
+            else temps_in(dst, ids, in.uses); // array index of a store
+
+            if (!is_temp(dst)) in.opcode = "store";
+            else if (parts.size() > 0 && parts[0] == "call") in.opcode = "call";
+            else if (parts.size() == 3) in.opcode = parts[1];
+            else if (parts.size() == 1 && (parts[0][0] == '-' || parts[0][0] == '!' || parts[0][0] == '~') && !is_number(parts[0]))
+                in.opcode = parts[0][0] == '-' ? "neg" : string(1, parts[0][0]);
+            else if (parts.size() == 1 && is_number(parts[0])) in.opcode = "const";
+            else if (parts.size() == 1 && is_temp(parts[0])) in.opcode = "copy";
+            else in.opcode = "load";
+        }
+        return in;
+    }
+
+    // Backward liveness over the basic blocks, the result is the most temps
+    // live at any point between two instructions
+    static long max_live(const vector<instr>& code, const map<string, int>& label_at, int temp_count)
+    {
+        if (code.empty() || temp_count == 0) return 0;
+        size_t words = (temp_count + 63) / 64;
+        typedef vector<uint64_t> bits;
+
+        // Blocks start at labels and after jumps
+        vector<int> block_start{0};
+        vector<bool> leader(code.size() + 1, false);
+        for (auto& label : label_at) leader[label.second] = true;
+        for (size_t i = 0; i < code.size(); i++)
+            if (!code[i].targets.empty() || !code[i].falls_through) leader[i + 1] = true;
+        for (size_t i = 1; i < code.size(); i++)
+            if (leader[i]) block_start.push_back(i);
+        block_start.push_back(code.size());
+        int blocks = block_start.size() - 1;
+        vector<int> block_of(code.size() + 1, blocks);
+        for (int b = 0; b < blocks; b++)
+            for (int i = block_start[b]; i < block_start[b + 1]; i++) block_of[i] = b;
+
+        vector<vector<int>> succ(blocks);
+        vector<bits> use(blocks, bits(words)), def(blocks, bits(words)), in(blocks, bits(words)), out(blocks, bits(words));
+        for (int b = 0; b < blocks; b++)
+        {
+            const instr& last = code[block_start[b + 1] - 1];
+            for (const string& t : last.targets)
+            {
+                auto it = label_at.find(t);
+                if (it != label_at.end() && block_of[it->second] < blocks) succ[b].push_back(block_of[it->second]);
+            }
+            if (last.falls_through && b + 1 < blocks) succ[b].push_back(b + 1);
+            for (int i = block_start[b + 1] - 1; i >= block_start[b]; i--)
+            {
+                if (code[i].def >= 0)
+                {
+                    def[b][code[i].def / 64] |= 1ull << (code[i].def % 64);
+                    use[b][code[i].def / 64] &= ~(1ull << (code[i].def % 64));
+                }
+                for (int u : code[i].uses) use[b][u / 64] |= 1ull << (u % 64);
+            }
+        }
+
+        for (bool changed = true; changed;)
+        {
+            changed = false;
+            for (int b = blocks - 1; b >= 0; b--)
+            {
+                for (int s : succ[b])
+                    for (size_t w = 0; w < words; w++) out[b][w] |= in[s][w];
+                for (size_t w = 0; w < words; w++)
+                {
+                    uint64_t live = use[b][w] | (out[b][w] & ~def[b][w]);
+                    if (live != in[b][w]) in[b][w] = live, changed = true;
+                }
+            }
+        }
+
+        long most = 0;
+        for (int b = 0; b < blocks; b++)
+        {
+            bits live = out[b];
+            auto count = [&]() { long n = 0; for (uint64_t w : live) n += __builtin_popcountll(w); return n; };
+            most = max(most, count());
+            for (int i = block_start[b + 1] - 1; i >= block_start[b]; i--)
+            {
+                if (code[i].def >= 0) live[code[i].def / 64] &= ~(1ull << (code[i].def % 64));
+                for (int u : code[i].uses) live[u / 64] |= 1ull << (u % 64);
+                most = max(most, count());
+            }
+        }
+        return most;
+    }
+
+    void finish(const string& name, vector<instr>& code, map<string, int>& label_at, map<string, int>& temp_ids, long labels)
+    {
+        if (name == "" && code.empty()) return;
+        function_metrics m;
+        m.instructions = code.size();
+        m.temps = temp_ids.size();
+        m.labels = labels;
+        for (const instr& in : code)
+        {
+            m.opcodes[in.opcode]++;
+            if (!in.targets.empty()) m.jumps++;
+        }
+        m.loads = m.opcodes.count("load") ? m.opcodes["load"] : 0;
+        m.stores = m.opcodes.count("store") ? m.opcodes["store"] : 0;
+        m.calls = m.opcodes.count("call") ? m.opcodes["call"] : 0;
+        m.max_live = max_live(code, label_at, temp_ids.size());
+        functions.push_back({name == "" ? "(top level)" : name, m});
+
+        for (auto& op : m.opcodes) total.opcodes[op.first] += op.second;
+        total.instructions += m.instructions;
+        total.temps += m.temps;
+        total.labels += m.labels;
+        total.jumps += m.jumps;
+        total.loads += m.loads;
+        total.stores += m.stores;
+        total.calls += m.calls;
+        total.max_live = max(total.max_live, m.max_live);
+
+        code.clear();
+        label_at.clear();
+        temp_ids.clear();
+    }
+
+    // name metric value, one per line, the format metrics files are compared in
+    static void flatten(const string& name, const function_metrics& m, map<pair<string, string>, long>& out)
+    {
+        out[{name, "instructions"}] = m.instructions;
+        out[{name, "temps"}] = m.temps;
+        out[{name, "labels"}] = m.labels;
+        out[{name, "jumps"}] = m.jumps;
+        out[{name, "loads"}] = m.loads;
+        out[{name, "stores"}] = m.stores;
+        out[{name, "calls"}] = m.calls;
+        out[{name, "max_live_temps"}] = m.max_live;
+        for (auto& op : m.opcodes) out[{name, "op " + op.first}] = op.second;
+    }
+
+    map<pair<string, string>, long> flat() const
+    {
+        map<pair<string, string>, long> out;
+        for (auto& f : functions) flatten(f.first, f.second, out);
+        flatten("(total)", total, out);
+        return out;
+    }
+
+public:
+    // Reads a code.txt, functions start at their "// Function:" header
+    void analyze(istream& tac)
+    {
+        string line, name;
+        vector<instr> code;
+        map<string, int> label_at, temp_ids;
+        long labels = 0;
+        while (getline(tac, line))
+        {
+            if (line.rfind("// Function: ", 0) == 0)
+            {
+                finish(name, code, label_at, temp_ids, labels);
+                labels = 0;
+                size_t open = line.find('('), space = line.rfind(' ', open);
+                name = line.substr(space + 1, open - space - 1);
+                continue;
+            }
+            if (line == "" || line.rfind("//", 0) == 0 || line.rfind("data ", 0) == 0) continue;
+            if (line.back() == ':' && line.find(' ') == string::npos)
+            {
+                label_at[line.substr(0, line.size() - 1)] = code.size();
+                labels++;
+                continue;
+            }
+            code.push_back(decode(line, temp_ids));
+        }
+        finish(name, code, label_at, temp_ids, labels);
+    }
+
+    void report(ostream& out) const
+    {
+        out << "Three-address code metrics:" << endl;
+        out << left << setw(20) << "function" << right << setw(8) << "instrs" << setw(7) << "temps" << setw(8) << "labels"
+            << setw(7) << "jumps" << setw(7) << "loads" << setw(8) << "stores" << setw(7) << "calls" << setw(10) << "max live" << endl;
+        auto row = [&](const string& name, const function_metrics& m) {
+            out << left << setw(20) << name << right << setw(8) << m.instructions << setw(7) << m.temps << setw(8) << m.labels
+                << setw(7) << m.jumps << setw(7) << m.loads << setw(8) << m.stores << setw(7) << m.calls << setw(10) << m.max_live << endl;
+        };
+        for (auto& f : functions) row(f.first, f.second);
+        row("(total)", total);
+        out << "Instructions by opcode:";
+        for (auto& op : total.opcodes) out << " " << op.first << "=" << op.second;
+        out << endl << left;
+    }
+
+    bool write(const string& path) const
+    {
+        ofstream out(path, ios::trunc);
+        for (auto& m : flat()) out << m.first.first << "\t" << m.first.second << "\t" << m.second << "\n";
+        return (bool)out;
+    }
+
+    // Changes against a metrics file written by an earlier run, returns how many
+    int diff(const string& baseline_path, ostream& out) const
+    {
+        ifstream in(baseline_path);
+        if (!in)
+        {
+            out << "Couldn't read TAC metrics baseline " << baseline_path << endl;
+            return -1;
+        }
+        map<pair<string, string>, long> before, after = flat();
+        string line;
+        while (getline(in, line))
+        {
+            size_t a = line.find('\t'), b = line.find('\t', a + 1);
+            if (a == string::npos || b == string::npos) continue;
+            before[{line.substr(0, a), line.substr(a + 1, b - a - 1)}] = stol(line.substr(b + 1));
+        }
+
+        out << "Three-address code metrics against " << baseline_path << ":" << endl;
+        int changes = 0;
+        auto show = [&](const pair<string, string>& key, long was, long now) {
+            if (was == now) return;
+            out << "  " << left << setw(20) << key.first << setw(18) << key.second << right << setw(8) << was << " -> "
+                << setw(8) << now << "  (" << showpos << now - was << noshowpos << ")" << endl;
+            changes++;
+        };
+        for (auto& m : before) show(m.first, m.second, after.count(m.first) ? after[m.first] : 0);
+        for (auto& m : after)
+            if (!before.count(m.first)) show(m.first, 0, m.second);
+        if (changes == 0) out << "  no changes" << endl;
+        out << left;
+        return changes;
+    }
+};
+
+#endif // TAC_METRICS_H
@@ -0,0 +1,14 @@
+int f(int a, int a) {
+    return a;
+}
+int main() {
+    int x;
+    float y;
+    x = y;
+    x = x % 0;
+    x = nothing(1);
+    return x;
+}
+float f(int b) {
+    return 1.5;
+}
@@ -0,0 +1,12 @@
+int f(int a){ return a*2; }
+int main(){
+  int a,b,c,d;
+  float x;
+  a=1;b=2;c=3;d=0;
+  a = -a*b + c%2 - b/c*a;
+  b = a < b + c && !d;
+  c = a + b < c || d == 0;
+  d = !a + -b * - -c;
+  x = f(a) + 2.5 * (a - b);
+  return 0;
+}
@@ -0,0 +1,7 @@
+int main(){
+  float x;
+  x = 1.5e308 + .25;
+  x = 1e400;
+  x = 2.5e-400;
+  return 0;
+}
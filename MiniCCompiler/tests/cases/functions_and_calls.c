@@ -0,0 +1,47 @@
+int count;
+float scale[3];
+
+void tick() {
+    count++;
+}
+
+void nothing() {}
+
+int add(int a, int b) {
+    return a + b;
+}
+
+float mix(float x, int n, float y) {
+    return x * n + y;
+}
+
+int fact(int n) {
+    if (n <= 1) return 1;
+    return n * fact(n - 1);
+}
+
+int main() {
+    int i, r, v[4];
+    float f;
+    tick();
+    r = add(1, 2);
+    r = add(add(r, 3), fact(4));
+    f = mix(1.5, r, scale[1]);
+    for (i = 0; i < 4; i++) v[i] = i * i;
+    i = v[2]--;
+    i = v[3]++;
+    r = -(r + i) != 0 || !count;
+    if (r > 2) r = 2; else r = 3;
+    switch (r) {
+        case 2: r = 1; break;
+        default:
+    }
+    nothing();
+    printf(r);
+    {
+        int r;
+        r = 7;
+        printf(r);
+    }
+    return r;
+}
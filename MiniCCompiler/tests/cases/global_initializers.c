@@ -0,0 +1,11 @@
+int sz;
+int tbl[2*4] = {1, 2, 3+4, -5, 10/3};
+float pi = 3.25, half = 1.0/2;
+int flags = 3 > 2 && 1;
+int arr[3] = {1,2,3};
+int exact = 9007199254740993 - 0, wrapped = 4611686018427387904 * 2 / 3;
+int main() {
+    int loc = sz * 2, v[2] = {sz, 4}, rest[4] = {sz};
+    float part[3] = {1.5};
+    return loc;
+}
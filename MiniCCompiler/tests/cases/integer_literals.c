@@ -0,0 +1,8 @@
+int main(){
+  int a;
+  a = 017 + 0x1F + 0;
+  a = 09;
+  a = 0x7FFFFFFFFFFFFFFF;
+  a = 9223372036854775808;
+  return a;
+}
@@ -0,0 +1 @@
+int main(){ break; continue; switch(1){case 1: continue;} return 0; }
@@ -0,0 +1,10 @@
+int g[0x4] = {1, 010, 0x1F, 00};
+float h = 2;
+int main(){
+  int a, b[2*0x2];
+  float x;
+  a = 0x10 + 010;
+  x = 1e3 + 2.0 + .5;
+  a = a / 2;
+  return 0;
+}
@@ -0,0 +1,15 @@
+int main() {
+    int i, s;
+    s = 0;
+    for (i = 0; i < 10; i++) {
+        if (i == 3) continue;
+        switch (i) { case 7: break; case 8: continue; }
+        if (i == 9) break;
+        s = s + i;
+    }
+    while (s > 0) {
+        s = s - 1;
+        if (s == 5) break;
+    }
+    return s;
+}
@@ -0,0 +1,13 @@
+int main() {
+    int i, s;
+    s = 0;
+    i = 0;
+    do {
+        s = s + i;
+        i++;
+    } while (i < 5);
+    while (i > 0) { i = i - 1; if (i == 2) continue; s = s + 1; }
+    for (i = 0; i < 3; i++) s = s * 2;
+    for (;;i++) { break; }
+    return s;
+}
@@ -0,0 +1,9 @@
+int main() {
+    int a;
+    a = b;
+    a = ;
+    a = c;
+    a = 1 + ;
+    a = d;
+    return a;
+}
@@ -0,0 +1,6 @@
+int f0(int a){ return a + nope0; }
+int f1(int a){ return a + nope1; }
+int f2(int a){ return a + nope2; }
+int f3(int a){ return a + nope3; }
+int f4(int a){ return a + nope4; }
+int main(){ return f0(1); }
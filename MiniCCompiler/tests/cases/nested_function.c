@@ -0,0 +1,8 @@
+int main() {
+    int a;
+    int inner(int b) {
+        return b * 2;
+    }
+    a = 3;
+    return a;
+}
@@ -0,0 +1,24 @@
+int func() {
+
+    int a;
+
+    if (a>1){
+        float a;
+
+        if (a>1) {
+            int a;
+
+             if (a>1) {
+                float a;
+
+                if (a>1) {
+                    int a;
+
+                    if (a>1) {
+                        float a;
+                    }
+                }
+             }
+        }
+    }
+}
\ No newline at end of file
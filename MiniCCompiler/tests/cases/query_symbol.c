@@ -0,0 +1,19 @@
+int g;
+float arr[4];
+int sq(int x) {
+    return x*x;
+}
+int unused(float y) {
+    int q;
+    q = undefinedvar;
+    return q;
+}
+int main() {
+    int a;
+    a = sq(3);
+    g = helper(a);
+    return a;
+}
+int helper(int z) {
+    return z+1;
+}
@@ -0,0 +1,71 @@
+int g1, g2[5];
+float gf = 1.5;
+void vv;
+int gi = g1;
+int a = {1};
+int arr[3] = 5;
+int arr2[2] = {1, 2, 3};
+int arr3[0];
+int arr4[2.5], arr5[4294967296];
+int g1;
+int f(int a, float b, int a) {
+    return a;
+}
+int h(int, float x) {
+    return 1;
+}
+void p() {
+    int x;
+    x = 2;
+}
+int f(int q) {
+    return q;
+}
+float r() { return 1.0; }
+int main() {
+    int x, y[4], z;
+    float w;
+    x = w;
+    x = y;
+    x = main;
+    z = y[w];
+    z = x[1];
+    z = undeclared + 1;
+    z = undeclared * 2;
+    z = x % 0;
+    z = x / 0;
+    w = w % 2;
+    z = p() + 1;
+    z = -p();
+    z = !p();
+    z = f(1, 2.0);
+    z = f(1);
+    z = f(1.5, 2, 3);
+    z = f(w, 1, 2);
+    z = nofunc(3);
+    z = nofunc(4);
+    switch (w) {
+        case 1: z = 1;
+        case 1: break;
+        default: z = 2;
+        default: z = 3;
+    }
+    break;
+    continue;
+    while (x) { continue; break; }
+    for (x = 0; x < 3; x++) { int x; x = 5; }
+    do { break; } while (x);
+    int k = p();
+    float ff = z;
+    int kk = 2.5;
+    println(y);
+    println(nothere);
+    {
+        int inner;
+        inner = outer;
+    }
+    int q[x];
+    return 0;
+}
+int late() { return main(); }
+int gg = 1 / 0;
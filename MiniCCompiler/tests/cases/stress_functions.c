@@ -0,0 +1,1043 @@
+int g;
+float fa[10];
+int f0(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f1(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f2(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f3(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f4(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f5(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f6(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f7(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f8(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f9(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f10(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f11(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f12(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f13(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f14(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f15(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f16(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f17(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f18(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f19(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f20(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f21(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f22(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f23(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f24(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f25(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f26(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f27(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f28(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f29(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f30(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f31(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f32(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f33(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f34(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f35(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f36(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f37(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f38(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int f39(int a, int b) {
+  int x, y, i;
+  x = a; y = b;
+  x = x + y * 0 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 1 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 2 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 3 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 4 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 5 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 6 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 7 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 8 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  x = x + y * 9 - (a - b) / 3 + x % 7;
+  if (x > y && a < 10) y = y + 1; else x = x - 1;
+  for (i = 0; i < 10; i++) { y = y + i; }
+  return x + y;
+}
+int main() { int r; r = f0(1, 2) + f39(3, 4); return r; }
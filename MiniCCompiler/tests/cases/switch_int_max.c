@@ -0,0 +1,12 @@
+int main(){
+  int x, r;
+  x = 2147483646;
+  r = 0;
+  switch (x) {
+    case 2147483644: r = 1; break;
+    case 2147483645: r = 2; break;
+    case 2147483646: r = 3; break;
+    case 2147483647: r = 4; break;
+  }
+  return r;
+}
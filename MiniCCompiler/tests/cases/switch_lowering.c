@@ -0,0 +1,27 @@
+int main() {
+    int s, r;
+    s = 2;
+    switch (s) {
+        case 1: r = 10;
+        case 2: r = 20;
+        default: r = 0;
+    }
+    switch (s) {
+        case 0: r = 1;
+        case 1: r = 2;
+        case 2: r = 3;
+        case 4: r = 4;
+        case 5: r = 5;
+    }
+    switch (s) {
+        case 1: r = 1;
+        case 100: r = 2;
+        case 200: r = 3;
+        case 3000: r = 4;
+        case 40000: r = 5;
+        case 40001:
+        default: r = 9;
+    }
+
+    return r;
+}
@@ -0,0 +1,10 @@
+int main(){
+  int x, r;
+  x = 0;
+  r = 5;
+  switch (x) {
+    case 4294967296: r = 1; break;
+    case 0: r = 2; break;
+  }
+  return r;
+}
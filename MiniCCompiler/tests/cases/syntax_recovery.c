@@ -0,0 +1,23 @@
+int good(int a) {
+    return a + 1;
+}
+int broken( {
+    return 0;
+}
+int g = ;
+void first() {
+    = 1;
+    g = 2;
+}
+int unnamed(int a, float) {
+    return a;
+}
+int main() {
+    int x;
+    x = 1 +;
+    x = good(x);
+    if (x > ) x = 2;
+    while (x < 3) x++;
+    return x
+}
+float after;
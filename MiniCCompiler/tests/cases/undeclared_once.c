@@ -0,0 +1,11 @@
+int main(){
+  int a;
+  a = x + y;
+  a = x * 2;
+  a = y;
+  b = 1;
+  c = 2;
+  d = 3;
+  return 0;
+}
+int g(){ return x; }
@@ -0,0 +1,417 @@
+// Differential testing of the compiler.
+//
+// Generates random terminating mini-C programs, compiles each one in every
+// configuration below with --run, and compares what main returns and the
+// final globals against the same program built by the host C compiler (ints
+// widened to long long, wrapping) and against the first configuration.
+// A mismatch is reduced to a minimal reproducer by dropping lines and whole
+// blocks while it persists, and saved with the expected and actual results.
+// Executed TAC instructions per configuration give the speedup of each one
+// over the first.
+//
+// Build: g++ -std=c++17 -O2 -o difftest tests/difftest.cpp
+// Usage: difftest [--count=N] [--seed=S] [--compiler=PATH] [--cc=HOST_CC] [--out=DIR]
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Code generation configurations, the first is the reference for the others.
+// Optimization levels belong here once the compiler has them.
+static const vector<pair<string, string>> configurations = {
+    {"default", ""},
+    {"push", "--push"},
+    {"jobs", "--jobs=4"},
+    {"lazy", "--lazy"},
+    {"split", "--split-output=parts"}, // temps and labels restart in every function
+};
+
+static string compiler = "./two_pass_compiler";
+static string host_cc = "cc";
+static string work_dir;
+
+// Random programs that always terminate and stay away from what the
+// language leaves undefined or lowers on purpose differently from C:
+// every loop counts a counter nobody else writes, divisors are never zero,
+// indexes are taken modulo the array size, calls only form a whole right
+// hand side (&& and || evaluate both operands), ++ and -- are statements
+// and no name is declared twice.
+class program_generator
+{
+private:
+    mt19937 rng;
+    vector<string> lines;
+    vector<string> readable, writable;
+    vector<pair<string, int>> callable; // earlier functions and their arity
+    vector<char> loops;                 // 'f' for, 'w' while or do, 's' switch
+    int counters = 0;
+
+    int pick(int n) { return rng() % n; }
+
+    string expr(int depth)
+    {
+        if (depth == 0 || pick(4) == 0)
+        {
+            int leaf = pick(10);
+            if (leaf < 4) return to_string(pick(20));
+            if (leaf < 5) return "ga[(" + expr(0) + " % 8 + 8) % 8]";
+            return readable[pick(readable.size())];
+        }
+        static const char* ops[] = {"+", "-", "*", "<", ">", "<=", ">=", "==", "!=", "&&", "||"};
+        int kind = pick(16);
+        if (kind < 11) return "(" + expr(depth - 1) + " " + ops[kind] + " " + expr(depth - 1) + ")";
+        if (kind < 13) return "(" + expr(depth - 1) + (kind == 11 ? " / " : " % ") + "(" + expr(depth - 1) + " % 7 + 8))";
+        if (kind == 13) return "-(" + expr(depth - 1) + ")";
+        if (kind == 14) return "!(" + expr(depth - 1) + ")";
+        return "(" + expr(depth - 1) + ")";
+    }
+
+    string target()
+    {
+        return writable[pick(writable.size())];
+    }
+
+    void emit(int indent, const string& line)
+    {
+        lines.push_back(string(4 * indent, ' ') + line);
+    }
+
+    void statements(int indent, int depth, int count)
+    {
+        for (int i = 0; i < count; i++) statement(indent, depth);
+    }
+
+    void statement(int indent, int depth)
+    {
+        int kind = pick(depth > 0 ? 13 : 6);
+        if (kind < 3) emit(indent, target() + " = " + expr(3) + ";");
+        else if (kind == 3) emit(indent, "ga[(" + expr(1) + " % 8 + 8) % 8] = " + expr(2) + ";");
+        else if (kind == 4) emit(indent, target() + (pick(2) ? "++;" : "--;"));
+        else if (kind == 5 && !callable.empty())
+        {
+            auto& f = callable[pick(callable.size())];
+            string args;
+            for (int a = 0; a < f.second; a++) args += (a ? ", " : "") + expr(2);
+            emit(indent, target() + " = " + f.first + "(" + args + ");");
+        }
+        else if (kind == 5 || kind == 6 || kind == 7)
+        {
+            emit(indent, "if (" + expr(2) + ") {");
+            statements(indent + 1, depth - 1, 1 + pick(2));
+            if (pick(2))
+            {
+                emit(indent, "} else {");
+                statements(indent + 1, depth - 1, 1 + pick(2));
+            }
+            emit(indent, "}");
+        }
+        else if (kind == 8 && counters < 6)
+        {
+            string i = "c" + to_string(counters++);
+            emit(indent, "for (" + i + " = 0; " + i + " < " + to_string(1 + pick(5)) + "; " + i + "++) {");
+            loop_body(indent + 1, depth - 1, 'f', i);
+            emit(indent, "}");
+        }
+        else if ((kind == 9 || kind == 10) && counters < 6)
+        {
+            string w = "c" + to_string(counters++);
+            emit(indent, w + " = " + to_string(pick(5)) + ";");
+            emit(indent, kind == 9 ? "while (" + w + " > 0) {" : "do {");
+            loop_body(indent + 1, depth - 1, 'w', w);
+            emit(indent + 1, w + "--;");
+            emit(indent, kind == 9 ? "}" : "} while (" + w + " > 0);");
+        }
+        else if (kind == 11)
+        {
+            emit(indent, "switch ((" + expr(2) + " % 4 + 4) % 4) {");
+            loops.push_back('s');
+            for (int c = 0; c < 3; c++)
+            {
+                emit(indent + 1, "case " + to_string(c) + ":");
+                statements(indent + 2, depth - 1, 1);
+                if (pick(3)) emit(indent + 2, "break;");
+            }
+            emit(indent + 1, "default:");
+            statements(indent + 2, depth - 1, 1);
+            loops.pop_back();
+            emit(indent, "}");
+        }
+        else if (kind == 12 && !loops.empty())
+        {
+            // continue skips a while loop's countdown, so only for loops get it
+            bool can_continue = find(loops.begin(), loops.end(), 'w') == loops.end() && count(loops.begin(), loops.end(), 'f');
+            emit(indent, "if (" + expr(2) + ") " + (can_continue && pick(2) ? "continue;" : "break;"));
+        }
+        else emit(indent, target() + " = " + expr(2) + ";");
+    }
+
+    void loop_body(int indent, int depth, char kind, const string& counter)
+    {
+        loops.push_back(kind);
+        statements(indent, depth, 1 + pick(3));
+        loops.pop_back();
+        readable.push_back(counter); // readable after the loop, never written by others
+    }
+
+    void function(const string& name, int arity)
+    {
+        readable = {"g0", "g1", "g2"};
+        writable = {"g0", "g1", "g2"};
+        counters = 0;
+        string params;
+        for (int a = 0; a < arity; a++)
+        {
+            params += (a ? ", int " : "int ") + string(1, 'p' + a);
+            readable.push_back(string(1, 'p' + a));
+            writable.push_back(string(1, 'p' + a));
+        }
+        emit(0, "int " + name + "(" + params + ") {");
+        emit(1, "int x = " + to_string(pick(10)) + ", y = " + to_string(pick(10)) + ", z = " + to_string(pick(10)) + ";");
+        emit(1, "int c0 = 0, c1 = 0, c2 = 0, c3 = 0, c4 = 0, c5 = 0;");
+        for (string v : {"x", "y", "z"})
+        {
+            readable.push_back(v);
+            writable.push_back(v);
+        }
+        statements(1, 3, 3 + pick(5));
+        emit(1, "return " + expr(3) + ";");
+        emit(0, "}");
+        callable.push_back({name, arity});
+    }
+
+public:
+    program_generator(unsigned seed) : rng(seed) {}
+
+    vector<string> generate()
+    {
+        emit(0, "int g0 = " + to_string(pick(10)) + ", g1, g2 = " + to_string(pick(10)) + ";");
+        emit(0, "int ga[8];");
+        int helpers = pick(3);
+        for (int f = 0; f < helpers; f++) function("f" + to_string(f), pick(3));
+        function("main", 0);
+        return lines;
+    }
+};
+
+static string join(const vector<string>& lines)
+{
+    string text;
+    for (auto& line : lines) text += line + "\n";
+    return text;
+}
+
+static void write_file(const string& path, const string& text)
+{
+    ofstream(path, ios::trunc) << text;
+}
+
+static string read_file(const string& path)
+{
+    ifstream in(path);
+    stringstream text;
+    text << in.rdbuf();
+    return text.str();
+}
+
+static int shell(const string& command)
+{
+    return system(command.c_str());
+}
+
+// What main returned and the globals, or "" when the host build failed
+static string run_host(const vector<string>& program)
+{
+    string source = "#define int long long\n#define main mc_main\n" + join(program) +
+                    "#undef main\n#undef int\n#include <stdio.h>\n"
+                    "int main(void) {\n"
+                    "    printf(\"Program returned %lld\\n\", mc_main());\n"
+                    "    printf(\"g0 = %lld\\ng1 = %lld\\ng2 = %lld\\nga =\", g0, g1, g2);\n"
+                    "    for (int i = 0; i < 8; i++) printf(\"%s %lld\", i ? \",\" : \"\", ga[i]);\n"
+                    "    printf(\"\\n\");\n"
+                    "    return 0;\n"
+                    "}\n";
+    write_file(work_dir + "/host.c", source);
+    if (shell(host_cc + " -w -fwrapv -O0 -o " + work_dir + "/host " + work_dir + "/host.c 2>/dev/null") != 0) return "";
+    if (shell("timeout 5 " + work_dir + "/host > " + work_dir + "/host.txt") != 0) return "";
+    return read_file(work_dir + "/host.txt");
+}
+
+struct compiled
+{
+    string result;           // the executor's report, "" when the program did not compile
+    unsigned long executed = 0;
+};
+
+static compiled run_compiler(const vector<string>& program, const string& flags)
+{
+    compiled out;
+    write_file(work_dir + "/prog.c", join(program));
+    shell("cd " + work_dir + " && timeout 20 " + compiler + " " + flags + " --run prog.c > run.txt 2>&1");
+    if (read_file(work_dir + "/error.txt").find("Total errors: 0") == string::npos) return out;
+
+    istringstream report(read_file(work_dir + "/run.txt"));
+    string line;
+    bool in_result = false;
+    while (getline(report, line))
+    {
+        if (line.rfind("Program returned", 0) == 0 || line.rfind("Run failed", 0) == 0) in_result = true;
+        if (line.rfind("Executed ", 0) == 0)
+        {
+            out.executed = stoul(line.substr(9));
+            break;
+        }
+        if (in_result) out.result += line + "\n";
+    }
+    if (out.result == "") out.result = "no result (crashed or timed out)\n";
+    return out;
+}
+
+// The mismatch still shows: the host builds and runs it, we compile it, and the results differ
+static bool still_fails(const vector<string>& program, const string& flags)
+{
+    string expected = run_host(program);
+    if (expected == "") return false;
+    compiled actual = run_compiler(program, flags);
+    return actual.result != "" && actual.result != expected;
+}
+
+// Greedy reduction: drop whole blocks, then single lines, until nothing more can go
+static vector<string> reduce(vector<string> program, const string& flags)
+{
+    for (bool progress = true; progress;)
+    {
+        progress = false;
+        for (int blocks = 1; blocks >= 0; blocks--)
+        {
+            for (size_t i = 0; i < program.size(); i++)
+            {
+                size_t end = i + 1;
+                if (blocks)
+                {
+                    if (program[i].back() != '{') continue;
+                    int depth = 0;
+                    for (end = i; end < program.size(); end++)
+                    {
+                        for (char c : program[end]) depth += c == '{' ? 1 : c == '}' ? -1 : 0;
+                        if (depth == 0) break;
+                    }
+                    if (end++ == program.size()) continue;
+                }
+                // Dropping a return would leave the host result undefined
+                bool keeps_returns = true;
+                for (size_t line = i; line < end; line++)
+                    if (program[line].find("return ") != string::npos) keeps_returns = false;
+                if (!keeps_returns) continue;
+
+                vector<string> smaller(program.begin(), program.begin() + i);
+                smaller.insert(smaller.end(), program.begin() + end, program.end());
+                if (still_fails(smaller, flags))
+                {
+                    program = smaller;
+                    progress = true;
+                    i--;
+                }
+            }
+        }
+    }
+    return program;
+}
+
+int main(int argc, char* argv[])
+{
+    int count = 100;
+    unsigned seed = random_device()();
+    string out_dir = "difftest_failures";
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg.rfind("--count=", 0) == 0) count = stoi(arg.substr(8));
+        else if (arg.rfind("--seed=", 0) == 0) seed = stoul(arg.substr(7));
+        else if (arg.rfind("--compiler=", 0) == 0) compiler = arg.substr(11);
+        else if (arg.rfind("--cc=", 0) == 0) host_cc = arg.substr(5);
+        else if (arg.rfind("--out=", 0) == 0) out_dir = arg.substr(6);
+        else
+        {
+            cout << "Usage: difftest [--count=N] [--seed=S] [--compiler=PATH] [--cc=HOST_CC] [--out=DIR]" << endl;
+            return 2;
+        }
+    }
+    if (compiler.find('/') != string::npos && compiler[0] != '/')
+    {
+        char* absolute = realpath(compiler.c_str(), NULL);
+        if (absolute == NULL)
+        {
+            cout << "No compiler at " << compiler << endl;
+            return 2;
+        }
+        compiler = absolute;
+        free(absolute);
+    }
+
+    char scratch[] = "/tmp/difftest.XXXXXX";
+    work_dir = mkdtemp(scratch);
+    shell("mkdir -p " + out_dir);
+
+    cout << "Seeds " << seed << " to " << seed + count - 1 << endl;
+    vector<unsigned long> executed(configurations.size(), 0);
+    vector<int> mismatches(configurations.size(), 0);
+    int tested = 0, skipped = 0;
+    for (int n = 0; n < count; n++)
+    {
+        vector<string> program = program_generator(seed + n).generate();
+        string expected = run_host(program);
+        if (expected == "")
+        {
+            skipped++; // did not build or finish on the host either
+            write_file(out_dir + "/seed" + to_string(seed + n) + "_host_failed.c", join(program));
+            continue;
+        }
+
+        vector<compiled> results;
+        for (auto& config : configurations) results.push_back(run_compiler(program, config.second));
+        if (results[0].result == "")
+        {
+            skipped++; // not valid mini-C, a generator problem rather than a miscompile
+            write_file(out_dir + "/seed" + to_string(seed + n) + "_rejected.c", join(program));
+            continue;
+        }
+        tested++;
+
+        for (size_t c = 0; c < configurations.size(); c++)
+        {
+            executed[c] += results[c].executed;
+            bool wrong = results[c].result != expected || results[c].result != results[0].result;
+            if (!wrong) continue;
+            mismatches[c]++;
+            string name = out_dir + "/seed" + to_string(seed + n) + "_" + configurations[c].first;
+            cout << "MISMATCH seed " << seed + n << " (" << configurations[c].first << "), reducing..." << flush;
+            vector<string> reduced = reduce(program, configurations[c].second);
+            write_file(name + ".c", join(reduced));
+            write_file(name + ".expected", run_host(reduced));
+            write_file(name + ".actual", run_compiler(reduced, configurations[c].second).result);
+            write_file(name + ".original.c", join(program));
+            cout << " " << program.size() << " -> " << reduced.size() << " lines, saved as " << name << ".c" << endl;
+        }
+    }
+    shell("rm -rf " + work_dir);
+
+    cout << tested << " programs compared, " << skipped << " skipped" << endl;
+    cout << left << setw(10) << "config" << right << setw(12) << "mismatches" << setw(18) << "TAC executed" << setw(10) << "speedup" << endl;
+    for (size_t c = 0; c < configurations.size(); c++)
+    {
+        cout << left << setw(10) << configurations[c].first << right << setw(12) << mismatches[c] << setw(18) << executed[c]
+             << setw(9) << fixed << setprecision(2) << (executed[c] ? (double)executed[0] / executed[c] : 0) << "x" << endl;
+    }
+    for (int m : mismatches)
+        if (m) return 1;
+    return 0;
+}
@@ -0,0 +1,169 @@
+#!/bin/bash
+
+# Golden-output regression tests with performance budgets.
+#
+# Each tests/cases/NAME.c is compiled (with the flags in NAME.args, if any) and
+# its code.txt and error.txt must match tests/expected/NAME.code.txt and
+# NAME.error.txt. The run must also stay within the budgets in budgets.txt:
+# cpu time, peak RSS and the number of emitted TAC instructions. Checking the
+# bodies on threads (--jobs=4) must give the same log.txt, code.txt and error.txt,
+# and writing each function to its own file (--split-output) the same code.txt.
+# A full run also checks that code that can not be written (-o /dev/full with
+# and without --mmap-output, a --split-output directory that is a file) is
+# reported in error.txt and fails the run, that a malformed option number or
+# a conflicting pair of options is a usage error (exit status 2, no files), and
+# that a --diagnostics-fd reader going away does not stop the compile.
+#
+# Usage: tests/run_tests.sh [--update] [NAME...]
+#   --update  rewrites the expected outputs from this run and prints the
+#             measured numbers in budgets.txt format (budgets are kept by hand)
+#   COMPILER  overrides the compiler, ./two_pass_compiler by default
+
+TESTS=$(cd "$(dirname "$0")" && pwd)
+COMPILER=${COMPILER:-$TESTS/../two_pass_compiler}
+COMPILER=$(cd "$(dirname "$COMPILER")" && pwd)/$(basename "$COMPILER")
+
+update=0
+if [ "$1" = "--update" ]; then
+    update=1
+    shift
+fi
+
+if [ ! -x "$COMPILER" ]; then
+    echo "No compiler at $COMPILER, build it with script.sh or set COMPILER"
+    exit 2
+fi
+
+names="$@"
+if [ -z "$names" ]; then
+    names=$(cd "$TESTS/cases" && ls *.c | sed 's/\.c$//')
+    output_checks=1
+fi
+
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+# Instructions are the code.txt lines that are not comments, labels or data
+count_instructions() {
+    grep -cvE '^(//.*|[[:space:]]*|[A-Za-z_][A-Za-z0-9_]*:|data .*)$' "$1"
+}
+
+passed=0
+failed=0
+
+# Counts and prints the outcome of check $1 from the $problems it collected
+result() {
+    if [ -z "$problems" ]; then
+        passed=$((passed + 1))
+        echo "PASS $1"
+    else
+        failed=$((failed + 1))
+        echo -e "FAIL $1$problems"
+    fi
+}
+for name in $names; do
+    rm -rf "$work"/*
+    args=$(cat "$TESTS/cases/$name.args" 2>/dev/null)
+    (cd "$work" && "$COMPILER" $args --resource-usage "$TESTS/cases/$name.c" > stdout.txt 2>&1)
+
+    usage=$(grep '^Resource usage:' "$work/stdout.txt")
+    cpu_ms=$(echo "$usage" | awk '{print $3}')
+    rss_kb=$(echo "$usage" | awk '{print $6}')
+    instructions=$(count_instructions "$work/code.txt")
+
+    if [ $update = 1 ]; then
+        cp "$work/code.txt" "$TESTS/expected/$name.code.txt"
+        cp "$work/error.txt" "$TESTS/expected/$name.error.txt"
+        printf "%-24s %8s %8s %8s\n" "$name" "$cpu_ms" "$rss_kb" "$instructions"
+        continue
+    fi
+
+    problems=""
+    for out in code error; do
+        if ! diff -u "$TESTS/expected/$name.$out.txt" "$work/$out.txt" > "$work/$out.diff"; then
+            problems="$problems\n  $out.txt differs from expected/$name.$out.txt:\n$(head -n 20 "$work/$out.diff" | sed 's/^/    /')"
+        fi
+    done
+
+    case " $args " in
+        *" --push "*|*" --lazy "*|*" --query="*) ;; # no deferred bodies to check on threads
+        *)
+            mkdir "$work/jobs"
+            (cd "$work/jobs" && "$COMPILER" $args --jobs=4 "$TESTS/cases/$name.c" > /dev/null 2>&1)
+            for out in log code error; do
+                cmp -s "$work/$out.txt" "$work/jobs/$out.txt" || problems="$problems\n  --jobs=4 changes $out.txt"
+            done;;
+    esac
+
+    mkdir "$work/split"
+    (cd "$work/split" && "$COMPILER" $args --split-output=parts "$TESTS/cases/$name.c" > /dev/null 2>&1)
+    cmp -s "$work/code.txt" "$work/split/code.txt" || problems="$problems\n  --split-output changes code.txt"
+
+    budget=$(awk -v n="$name" '$1 == n' "$TESTS/budgets.txt")
+    if [ -z "$budget" ]; then
+        problems="$problems\n  no budget in budgets.txt"
+    elif [ -z "$usage" ]; then
+        problems="$problems\n  the compiler did not finish"
+    else
+        read -r _ max_cpu max_rss max_instructions <<< "$budget"
+        [ "$cpu_ms" -gt "$max_cpu" ] && problems="$problems\n  cpu time $cpu_ms ms is over the budget of $max_cpu ms"
+        [ "$rss_kb" -gt "$max_rss" ] && problems="$problems\n  peak RSS $rss_kb KB is over the budget of $max_rss KB"
+        [ "$instructions" -gt "$max_instructions" ] && problems="$problems\n  $instructions TAC instructions, over the budget of $max_instructions"
+    fi
+
+    if [ -z "$problems" ]; then
+        passed=$((passed + 1))
+        echo "PASS $name"
+    else
+        failed=$((failed + 1))
+        echo -e "FAIL $name$problems"
+    fi
+done
+
+if [ $update = 1 ]; then
+    exit 0
+fi
+
+if [ -n "$output_checks" ]; then
+    for mode in "" --mmap-output; do
+        rm -rf "$work"/*
+        name="unwritable_output${mode:+ $mode}"
+        problems=""
+        (cd "$work" && "$COMPILER" $mode -o /dev/full "$TESTS/cases/sample_input.c" > /dev/null 2>&1) && problems="$problems\n  exit status 0"
+        grep -q "^Couldn't write /dev/full: " "$work/error.txt" || problems="$problems\n  no output-failed diagnostic in error.txt"
+        result "$name"
+    done
+
+    rm -rf "$work"/*
+    problems=""
+    touch "$work/parts" # a file where the directory should be
+    (cd "$work" && "$COMPILER" --split-output=parts "$TESTS/cases/functions_and_calls.c" > /dev/null 2>&1) && problems="$problems\n  exit status 0"
+    grep -q "^Couldn't write parts/" "$work/error.txt" || problems="$problems\n  no output-failed diagnostic in error.txt"
+    result unwritable_split_output
+
+    problems=""
+    usage_errors=(-fmax-errors=x -fmax-errors=-1 -fmax-errors=99999999999 --diagnostics-fd= --jobs=0 --jobs=4x
+                  --jobs=99999999999999999999 "--push --lazy" "-o - --mmap-output" "-o - --run")
+    for option in "${usage_errors[@]}"; do
+        rm -rf "$work"/*
+        (cd "$work" && "$COMPILER" $option "$TESTS/cases/sample_input.c" > /dev/null 2>&1)
+        status=$?
+        [ $status = 2 ] || problems="$problems\n  $option exits with $status"
+        [ -z "$(ls "$work")" ] || problems="$problems\n  $option creates $(ls "$work" | tr '\n' ' ')"
+    done
+    result usage_errors
+
+    # A pipe whose only reader is closed before the compiler writes to it
+    rm -rf "$work"/*
+    problems=""
+    mkfifo "$work/diagnostics"
+    exec 4<> "$work/diagnostics" 5> "$work/diagnostics" 4<&-
+    (cd "$work" && "$COMPILER" --diagnostics-format=jsonl --diagnostics-fd=5 "$TESTS/cases/semantic_errors.c" > /dev/null 2>&1)
+    status=$?
+    exec 5>&-
+    [ $status = 0 ] || problems="$problems\n  exits with $status"
+    cmp -s "$TESTS/expected/semantic_errors.error.txt" "$work/error.txt" || problems="$problems\n  error.txt differs from expected/semantic_errors.error.txt"
+    result closed_diagnostics_reader
+fi
+echo "$passed passed, $failed failed"
+[ $failed = 0 ]
@@ -2,25 +2,104 @@
 #define THREE_ADDR_CODE_H
 
 #include "ast.h"
+#include "trace.h"
+#include "perf_counters.h"
 #include <fstream>
+#include <sstream>
 #include <string>
 #include <map>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <cerrno>
+#include <sys/stat.h>
 
 using namespace std;
 
 class ThreeAddrCodeGenerator {
 private:
     ProgramNode* ast_root;
-    ofstream& outcode;
+    ostream& outcode;
     // Tracks the most recent temp name for each symbol
     map<string, string> symbol_to_temp;
     int temp_count;
     int label_count;
 
+    // --split-output: every function also goes to its own file in split_dir
+    struct split_part { string name, file, hash; size_t size; };
+    string split_dir;
+    vector<split_part> parts;
+    int split_errno = 0; // of the first file that could not be written
+    string split_failed;
+
+    // FNV-1a, enough to tell whether a file changed between runs
+    static string content_hash(const string& text) {
+        uint64_t h = 14695981039346656037ULL;
+        for (unsigned char c : text) h = (h ^ c) * 1099511628211ULL;
+        char hex[17];
+        snprintf(hex, sizeof(hex), "%016llx", (unsigned long long)h);
+        return hex;
+    }
+
+    // Writes one part, leaving a file that already holds the same text untouched
+    void write_part(const string& name, const string& file, const string& text) {
+        parts.push_back({name, file, content_hash(text), text.size()});
+        string path = split_dir + "/" + file;
+        ifstream old(path, ios::binary);
+        if (old) {
+            stringstream old_text;
+            old_text << old.rdbuf();
+            if (old_text.str() == text) return;
+        }
+        errno = 0;
+        ofstream out(path, ios::binary | ios::trunc);
+        out << text;
+        out.close();
+        if (!out) split_failure(path);
+    }
+
+    void write_manifest() {
+        errno = 0;
+        ofstream out(split_dir + "/manifest.txt", ios::trunc);
+        out << "# name\tfile\tbytes\tfnv1a64\n";
+        for (auto& part : parts) out << part.name << "\t" << part.file << "\t" << part.size << "\t" << part.hash << "\n";
+        out.close();
+        if (!out) split_failure(split_dir + "/manifest.txt");
+    }
+
+    void split_failure(const string& path) {
+        if (split_errno) return;
+        split_errno = errno ? errno : EIO;
+        split_failed = path;
+    }
+
+    // code.txt is numbered as without splitting. A function's file is generated
+    // again with temps and labels from 0, so it only changes when the function does
+    void generate_split_code() {
+        for (auto unit : ast_root->get_units()) {
+            auto func = dynamic_cast<FuncDeclNode*>(unit);
+            unit->generate_code(outcode, symbol_to_temp, temp_count, label_count);
+            if (!func) continue;
+            ostringstream text;
+            map<string, string> file_temps;
+            int file_temp_count = 0, file_label_count = 0;
+            func->generate_code(text, file_temps, file_temp_count, file_label_count);
+            write_part(func->get_name(), func->get_name() + ".tac", text.str());
+        }
+    }
+
 public:
-    ThreeAddrCodeGenerator(ProgramNode* root, ofstream& out)
+    ThreeAddrCodeGenerator(ProgramNode* root, ostream& out)
         : ast_root(root), outcode(out), temp_count(0), label_count(0) {} //initialization of variables
 
+    // Functions are also written to DIR/NAME.tac, the data section to DIR/globals.data
+    // (neither name can clash with a function), and DIR/manifest.txt lists them all
+    void split_into(const string& dir) { split_dir = dir; }
+
+    // errno of the first split output file that could not be written, 0 when all were
+    int split_error() const { return split_errno; }
+    const string& split_error_path() const { return split_failed; }
+
     void generate() {
         // Write a simple header explaining the TAC format
         outcode << "//========== THREE ADDRESS CODE ==========\n\n";
@@ -28,13 +107,36 @@ public:
         outcode << "// Format: \n";
         outcode << "// - t0, t1, etc. are temporary variables\n";
         outcode << "// - L0, L1, etc. are labels for jumps\n";
+        outcode << "// - ifFalse t goto L jumps when t is zero\n";
+        outcode << "// - data type name = v, ... is a global with its initial values\n";
+        outcode << "// - jump_table t : La, Lb, ... jumps to the label at index t\n";
         outcode << "// - Operations follow the three-address code format\n\n";
 
+        if (ast_root) {
+            trace_span span("tac", "data section");
+            perf_phase counters("data section");
+            outcode << "// Data section\n\n";
+            if (split_dir == "") ast_root->generate_data(outcode);
+            else {
+                if (mkdir(split_dir.c_str(), 0777) != 0 && errno != EEXIST) split_failure(split_dir);
+                ostringstream data;
+                ast_root->generate_data(data);
+                outcode << data.str();
+                write_part("(data)", "globals.data", data.str());
+            }
+            outcode << "\n";
+        }
+
         outcode << "// Three Address Code\n\n";
 
         
         if (ast_root) {
-            ast_root->generate_code(outcode, symbol_to_temp, temp_count, label_count);
+            perf_phase counters("code section");
+            if (split_dir == "") ast_root->generate_code(outcode, symbol_to_temp, temp_count, label_count);
+            else {
+                generate_split_code();
+                write_manifest();
+            }
         }
 
         // Footer marker
@@ -0,0 +1,114 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Chrome trace-event output for --trace=FILE, open it in Perfetto or
+// chrome://tracing. Events are kept in memory and written once at exit.
+class tracer
+{
+private:
+    inline static mutex lock;
+    inline static vector<string> events;
+    inline static atomic<int> threads{0};
+    inline static const chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+    static void add(const string& event)
+    {
+        lock_guard<mutex> guard(lock);
+        events.push_back(event);
+    }
+
+    static string header(const string& name, const char* category, const char* phase, long ts)
+    {
+        return "{\"name\": \"" + name + "\", \"cat\": \"" + category + "\", \"ph\": \"" + phase +
+               "\", \"ts\": " + to_string(ts) + ", \"pid\": 1, \"tid\": " + to_string(tid());
+    }
+
+public:
+    inline static bool enabled = false;
+
+    // Small stable number per thread, the first thread to ask (main) is 1
+    static int tid()
+    {
+        thread_local int id = ++threads;
+        return id;
+    }
+
+    static long now()
+    {
+        return chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+    }
+
+    static void name_thread(const string& name)
+    {
+        if (!enabled) return;
+        add("{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " + to_string(tid()) +
+            ", \"args\": {\"name\": \"" + name + "\"}}");
+    }
+
+    // A span that has already ended, args is a JSON object body without braces
+    static void complete(const string& name, const char* category, long begin, long end, const string& args = "")
+    {
+        if (!enabled) return;
+        string event = header(name, category, "X", begin) + ", \"dur\": " + to_string(end - begin);
+        if (args != "") event += ", \"args\": {" + args + "}";
+        add(event + "}");
+    }
+
+    // Spans that open and close in different functions, they nest per thread
+    static void begin(const string& name, const char* category)
+    {
+        if (enabled) add(header(name, category, "B", now()) + "}");
+    }
+
+    static void end(const string& name, const char* category)
+    {
+        if (enabled) add(header(name, category, "E", now()) + "}");
+    }
+
+    static bool write(const string& path)
+    {
+        ofstream out(path, ios::trunc);
+        if (!out) return false;
+        lock_guard<mutex> guard(lock);
+        out << "{\"traceEvents\": [\n";
+        for (size_t i = 0; i < events.size(); i++)
+        {
+            out << (i ? ",\n" : "") << events[i];
+        }
+        out << "\n], \"displayTimeUnit\": \"ms\"}\n";
+        return (bool)out;
+    }
+};
+
+// Times the enclosing block, the name is only built when tracing is on
+class trace_span
+{
+private:
+    string name;
+    const char* category;
+    long begin;
+
+public:
+    trace_span(const char* category, const char* prefix, const string& suffix = "") : category(category)
+    {
+        if (!tracer::enabled) return;
+        name = prefix + suffix;
+        begin = tracer::now();
+    }
+
+    ~trace_span()
+    {
+        if (tracer::enabled) tracer::complete(name, category, begin, tracer::now());
+    }
+};
+
+#endif // TRACE_H